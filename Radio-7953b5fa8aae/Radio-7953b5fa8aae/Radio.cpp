@@ -19,35 +19,70 @@ Radio::Radio(PinName mosi, PinName miso, PinName sck, PinName csn, PinName ce, P
     // Set to use controller channel 0
     controller = 0;
     
+    irqPending = false;
+    irqTime = 0;
+    txBusy = false;
+    ackWaiting = false;
+    acksSent = 0;
+    link = LINK_TURNAROUND;
+    schedule = NULL;
+    channel = RF_CHANNEL;
+    synced = false;
+    rxSeq = 0;
+    memset(&state, 0, sizeof(state));
+    lastControllerFrame = -1;
+    _clock.start();
+    
     // Set up IRQ
-    _irq.fall(this, &Radio::receive);
+    _irq.fall(this, &Radio::interrupt);
 }
 
 
 
-void Radio::reset()
+void Radio::reset(radio_link_t link)
 {
+    this->link = link;
+    ackWaiting = false;
+    synced = false;
+    if (schedule)
+    {
+        controller = schedule->pair();
+        channel = schedule->channel(0);
+    }
+    else channel = RF_CHANNEL;
+    
     // Wait for power on reset
     wait_us(TIMING_Tpor);
 
     // Put into standby
     _ce = 0;
     
-    // Configure registers
-    setRegister(CONFIG, CONFIG_MASK_TX_DS | CONFIG_MASK_MAX_RT | CONFIG_EN_CRC | CONFIG_PWR_UP | CONFIG_PRIM_RX);
-    setRegister(EN_AA, 0x00);
-    setRegister(EN_RXADDR, ERX_P0 | ERX_P1);
+    // Configure registers. TX_DS is left unmasked so a finished transmission,
+    // or an ACK carrying telemetry, raises the IRQ.
+    config = CONFIG_MASK_MAX_RT | CONFIG_EN_CRC | CONFIG_PWR_UP | CONFIG_PRIM_RX;
+    setRegister(CONFIG, config);
+    setRegister(EN_AA, link == LINK_ACK_PAYLOAD ? ENAA_P0 : 0x00);
+    setRegister(EN_RXADDR, schedule ? 0x3f : ERX_P0 | ERX_P1);
     setRegister(SETUP_AW, SETUP_AW_3BYTES);
     setRegister(SETUP_RETR, 0x00);
-    setRegister(RF_CH, RF_CHANNEL);
+    setRegister(RF_CH, channel);
     setRegister(RF_SETUP, RF_SETUP_RF_DR_HIGH | RF_SETUP_RF_PWR_0);
     setRegister(STATUS, STATUS_RX_DR | STATUS_TX_DS | STATUS_MAX_RT);
-    setRegister(RX_PW_P0, 4);
-    setRegister(RX_PW_P1, 4);
-    setRegister(DYNPD, 0x00);
-    setRegister(FEATURE, 0x00);
+    if (link == LINK_ACK_PAYLOAD)
+        setRegister(FEATURE, FEATURE_EN_DPL | FEATURE_EN_ACK_PAY | FEATURE_EN_DYN_ACK);
+    else
+        setRegister(FEATURE, FEATURE_EN_DPL);
+    setRegister(DYNPD, schedule ? 0x3f : DPL_P0 | DPL_P1);
     
-    // Set addresses
+    // Set addresses. In the arena pipes 2-5 differ from the all robots
+    // address on pipe 1 in the low byte only.
+    if (schedule)
+    {
+        setRegister(RX_ADDR_P2, ARENA_ROBOT_LSB + schedule->pair());
+        setRegister(RX_ADDR_P3, ARENA_TEAM_LSB + schedule->team());
+        setRegister(RX_ADDR_P4, ARENA_REFEREE_LSB);
+        setRegister(RX_ADDR_P5, ARENA_PIT_LSB + schedule->pair());
+    }
     _csn = 0;
     _spi.write(W_REGISTER | RX_ADDR_P0);
     _spi.write(CTRL_BASE_ADDRESS_1 + (controller & 0xf));
@@ -78,91 +113,226 @@ void Radio::reset()
     _csn = 0;
     _spi.write(FLUSH_RX);
     _csn = 1;
+    
+    // An IRQ from before the reset would stamp the next packet with its time
+    irqPending = false;
+    txBusy = false;
 }
 
 
 
-void Radio::transmit(uint32_t data)
+bool Radio::transmit(const uint8_t* data, int length)
 {
-    // Put into standby
+    if (txBusy || length < 1 || length > FRAME_MAX_LENGTH) return false;
+    txBusy = true;
+    
+    // Put into standby and configure for PTX
     _ce = 0;
+    setRegister(CONFIG, config & ~CONFIG_PRIM_RX);
     
-    // Configure for PTX
-    int config = getRegister(CONFIG);
-    config &= ~CONFIG_PRIM_RX;
-    setRegister(CONFIG, config);
+    // Write packet data. With dynamic payloads its length goes on air too.
+    // Auto acknowledge is on for pipe 0 with ack payloads, but nobody
+    // acknowledges robot packets.
+    transaction(link == LINK_ACK_PAYLOAD ? W_TX_PAYLOAD_NOACK : W_TX_PAYLOAD, data, NULL, length);
     
-    // Write packet data
-    _csn = 0;
-    _spi.write(W_TX_PAYLOAD);
-    _spi.write( (data>>0) & 0xff );
-    _spi.write( (data>>8) & 0xff );
-    _spi.write( (data>>16) & 0xff );
-    _spi.write( (data>>24) & 0xff );
-    _csn = 1;
-    
-    // Put into PTX
+    // Put into PTX. The packet goes out after Tstby2a and TX_DS raises the IRQ.
     _ce = 1;
-    wait_us(TIMING_Tstby2a);
-    _ce = 0;
     
-    // Wait for message transmission and put into PRX
-    wait_us(TIMING_Toa);
-    config = getRegister(CONFIG);
-    config |= CONFIG_PRIM_RX;
+    return true;
+}
+
+
+
+bool Radio::transmit(const radio_frame_t& frame)
+{
+    uint8_t data[FRAME_MAX_LENGTH];
+    int length = encodeFrame(frame, data);
+    return length && transmit(data, length);
+}
+
+
+
+bool Radio::setAckPayload(const radio_frame_t& frame)
+{
+    uint8_t data[FRAME_MAX_LENGTH];
+    if (link != LINK_ACK_PAYLOAD || ackWaiting) return false;
+    
+    int length = encodeFrame(frame, data);
+    if (!length) return false;
+    
+    // Written while listening; the chip sends it with the next ACK on pipe 0
+    ackWaiting = true;
+    transaction(W_ACK_PAYLOAD | 0, data, NULL, length);
+    return true;
+}
+
+
+
+void Radio::transmitDone()
+{
+    // Put back into PRX
+    _ce = 0;
     setRegister(CONFIG, config);
-    setRegister(STATUS, STATUS_TX_DS);
     _ce = 1;
+    
+    txBusy = false;
+    txDone.call();
 }
 
 
 
-void Radio::receive()
+void Radio::interrupt()
 {
-    uint32_t data = 0;
-    int pipe;
+    // Everything else waits for service()
+    irqTime = _clock.read_us();
+    irqPending = true;
+}
+
+
+
+void Radio::service()
+{
+    if (schedule) hop();
     
-    while (!(getRegister(FIFO_STATUS) & FIFO_STATUS_RX_EMPTY))
+    // Nothing to do unless the IRQ fired or is still held low
+    if (!irqPending && _irq.read()) return;
+    uint32_t time = irqPending ? irqTime : _clock.read_us();
+    irqPending = false;
+    
+    // Clear the interrupt flags first, so anything that happens from here on
+    // raises the IRQ again. STATUS is clocked out on the command byte of every
+    // transaction, so this also says whether a transmission finished and which
+    // pipe the payload at the head of the RX FIFO came from.
+    uint8_t flags = STATUS_RX_DR | STATUS_TX_DS | STATUS_MAX_RT;
+    int status = transaction(W_REGISTER | STATUS, &flags, NULL, 1);
+    
+    // TX_DS is either our own packet or, while listening, an ack payload
+    if (status & STATUS_TX_DS)
     {
-        // Check data pipe
-        //wait_us(1000);
-        pipe = getStatus() & STATUS_RN_P_MASK;
-        
-        // Read data
-        _csn = 0;
-        _spi.write(R_RX_PAYLOAD);
-        data |= _spi.write(NOP)<<0;
-        data |= _spi.write(NOP)<<8;
-        data |= _spi.write(NOP)<<16;
-        data |= _spi.write(NOP)<<24;
-        _csn = 1;
+        if (txBusy) transmitDone();
+        else if (ackWaiting)
+        {
+            ackWaiting = false;
+            ++acksSent;
+        }
+    }
+    
+    while ((status & STATUS_RN_P_MASK) != STATUS_RN_P_NO_EMPTY)
+    {
+        radio_packet_t packet;
+        uint8_t width;
+        transaction(R_RX_PL_WID, NULL, &width, 1);
         
-        // Sort into recieve buffer
-        switch(pipe)
+        // A corrupt width means the FIFO has to be flushed
+        if (width > FRAME_MAX_LENGTH)
         {
-        case STATUS_RN_P_NO_P0:
-            rx_controller = data;
-            clearTimeout.attach(this, &Radio::clear, 0.5f);
-            break;
-            
-        case STATUS_RN_P_NO_P1:
-            rx_robot[rx_robot_pos++ % RX_BUFFER_SIZE] = data;
-            break;
-            
-        default:
+            transaction(FLUSH_RX, NULL, NULL, 0);
+            ++rxSeq;
             break;
         }
+        
+        transaction(R_RX_PAYLOAD, NULL, packet.data, width);
+        packet.length = width;
+        packet.time = time;
+        packet.seq = rxSeq++;
+        packet.pipe = (status & STATUS_RN_P_MASK) >> 1;
+        if (schedule && packet.pipe == 0) sync(packet);
+        rxQueue.push(packet);
+        
+        // Clearing RX_DR again returns the pipe of the next payload
+        flags = STATUS_RX_DR;
+        status = transaction(W_REGISTER | STATUS, &flags, NULL, 1);
     }
+}
+
+
+
+void Radio::hop()
+{
+    // Not while sending, the packet would go out on the wrong channel
+    if (txBusy) return;
+    
+    // Count superframes from the last controller frame, changing channel half
+    // way between slots. Park on the first channel of the sequence once out
+    // of sync.
+    uint32_t elapsed = (uint32_t)_clock.read_us() - syncTime;
+    if (synced && elapsed > ARENA_SYNC_FRAMES*ARENA_FRAME_US) synced = false;
     
-    // Reset IRQ pin
-    setRegister(STATUS, STATUS_RX_DR);
+    int wanted = schedule->channel(0);
+    if (synced) wanted = schedule->channel(syncFrame + (elapsed + ARENA_FRAME_US/2)/ARENA_FRAME_US);
+    
+    if (wanted != channel)
+    {
+        _ce = 0;
+        setRegister(RF_CH, wanted);
+        channel = wanted;
+        _ce = 1;
+    }
 }
 
 
 
-void Radio::clear()
+void Radio::sync(const radio_packet_t& packet)
 {
-    rx_controller = 0;
+    // Frames are sent at the start of the slot, so the read time is close
+    // enough to it to pick channels by
+    radio_frame_t frame;
+    if (!decodeFrame(packet.data, packet.length, frame) || !(frame.types & (1<<MSG_SYNC))) return;
+    
+    syncFrame = frame.superframe;
+    syncTime = packet.time;
+    synced = true;
+}
+
+
+
+const radio_state_t& Radio::poll()
+{
+    radio_packet_t packet;
+    radio_frame_t frame;
+    
+    while (rxQueue.pop(packet))
+    {
+        ++state.received;
+        if (!decodeFrame(packet.data, packet.length, frame))
+        {
+            ++state.badFrames;
+            continue;
+        }
+        
+        // Sort into recieve buffer
+        switch (packet.pipe)
+        {
+        case 0:
+            if (frame.types & (1<<MSG_CONTROLLER))
+            {
+                if (lastControllerFrame >= 0)
+                    state.controllerLost += (uint8_t)(frame.seq - lastControllerFrame - 1);
+                lastControllerFrame = frame.seq;
+                state.controllerFrame = frame.seq;
+                state.controller = frame.controller;
+                state.controllerTime = packet.time;
+                state.controllerSeq = packet.seq;
+            }
+            break;
+            
+        default:
+            state.robot[state.robotPos] = frame;
+            state.robotPipe[state.robotPos] = packet.pipe;
+            state.robotPos = (state.robotPos + 1) % RX_BUFFER_SIZE;
+            break;
+        }
+    }
+    
+    // Stop if the controller has gone quiet
+    if (state.controller && (uint32_t)_clock.read_us() - state.controllerTime > CONTROLLER_TIMEOUT_US)
+        state.controller = 0;
+    
+    state.overruns = rxQueue.overruns;
+    state.ackPayloads = acksSent;
+    state.channel = channel;
+    state.synced = synced;
+    return state;
 }
 
 
@@ -181,8 +351,22 @@ int Radio::getRegister(int address)
 
 int Radio::getStatus()
 {
+    return transaction(NOP, NULL, NULL, 0);
+}
+
+
+
+int Radio::transaction(int command, const uint8_t* tx, uint8_t* rx, int length)
+{
+    // One command with its data bytes under a single chip select. Returns
+    // STATUS, which the chip clocks out with the command byte.
     _csn = 0;
-    int status = _spi.write(NOP);
+    int status = _spi.write(command);
+    for (int i = 0; i < length; ++i)
+    {
+        int value = _spi.write(tx ? tx[i] : NOP);
+        if (rx) rx[i] = value;
+    }
     _csn = 1;
     return status;
 }
@@ -232,63 +416,276 @@ RadioController::RadioController(PinName mosi, PinName miso, PinName sck, PinNam
     
     // Set to use controller channel 0
     controller = 0;
+    badFrames = 0;
+    txSeq = 0;
+    txBusy = false;
+    link = LINK_TURNAROUND;
+    schedule = NULL;
+    channel = RF_CHANNEL;
+    resetLinkStats();
+    _clock.start();
 }
 
 
 
-void RadioController::reset()
+void RadioController::reset(radio_link_t link)
 {
+    this->link = link;
+    txBusy = false;
+    if (schedule)
+    {
+        controller = schedule->pair();
+        channel = schedule->channel(0);
+    }
+    else channel = RF_CHANNEL;
+    
     // Wait for power on reset
     wait_us(TIMING_Tpor);
 
     // Put into standby
     _ce = 0;
     
-    // Configure registers
+    // Configure registers. There is no IRQ line, so the flags are polled. With
+    // ack payloads the ACK comes in on pipe 0, and 500 us is long enough to
+    // wait for one carrying a full frame at 2 Mbps.
     setRegister(CONFIG, CONFIG_MASK_RX_DR | CONFIG_MASK_TX_DS | CONFIG_MASK_MAX_RT | CONFIG_EN_CRC | CONFIG_PWR_UP);
-    setRegister(EN_AA, 0x00);
-    setRegister(EN_RXADDR, 0x00);
+    if (link == LINK_ACK_PAYLOAD)
+    {
+        setRegister(EN_AA, ENAA_P0);
+        setRegister(EN_RXADDR, ERX_P0);
+        setRegister(SETUP_RETR, (1<<SETUP_RETR_ARD_SHIFT) | 3);
+        setRegister(FEATURE, FEATURE_EN_DPL | FEATURE_EN_ACK_PAY);
+    }
+    else
+    {
+        setRegister(EN_AA, 0x00);
+        setRegister(EN_RXADDR, ERX_P1);
+        setRegister(SETUP_RETR, 0x00);
+        setRegister(FEATURE, FEATURE_EN_DPL);
+    }
     setRegister(SETUP_AW, SETUP_AW_3BYTES);
-    setRegister(SETUP_RETR, 0x00);
-    setRegister(RF_CH, RF_CHANNEL);
+    setRegister(RF_CH, channel);
     setRegister(RF_SETUP, RF_SETUP_RF_DR_HIGH | RF_SETUP_RF_PWR_0);
     setRegister(STATUS, STATUS_RX_DR | STATUS_TX_DS | STATUS_MAX_RT);
-    setRegister(DYNPD, 0x00);
-    setRegister(FEATURE, 0x00);
+    setRegister(DYNPD, DPL_P0 | DPL_P1);
     
-    // Set transmit address
+    // Set transmit address. ACKs come back from the same address on pipe 0,
+    // and robots are heard on pipe 1.
     _csn = 0;
     _spi.write(W_REGISTER | TX_ADDR);
     _spi.write(CTRL_BASE_ADDRESS_1 + (controller & 0xf));
     _spi.write(CTRL_BASE_ADDRESS_2);
     _spi.write(CTRL_BASE_ADDRESS_3);
     _csn = 1;
+    _csn = 0;
+    _spi.write(W_REGISTER | RX_ADDR_P0);
+    _spi.write(CTRL_BASE_ADDRESS_1 + (controller & 0xf));
+    _spi.write(CTRL_BASE_ADDRESS_2);
+    _spi.write(CTRL_BASE_ADDRESS_3);
+    _csn = 1;
+    _csn = 0;
+    _spi.write(W_REGISTER | RX_ADDR_P1);
+    _spi.write(ROBOT_ADDRESS_1);
+    _spi.write(ROBOT_ADDRESS_2);
+    _spi.write(ROBOT_ADDRESS_3);
+    _csn = 1;
     
-    // Flush TX FIFO
+    // Flush FIFOs
     _csn = 0;
     _spi.write(FLUSH_TX);
     _csn = 1;
+    _csn = 0;
+    _spi.write(FLUSH_RX);
+    _csn = 1;
+    
+    // Writing RF_CH cleared PLOS_CNT
+    plos = 0;
+    resetLinkStats();
 }
 
 
 
-void RadioController::transmit(uint32_t data)
-{   
+bool RadioController::transmit(const radio_frame_t& frame)
+{
+    uint8_t data[FRAME_MAX_LENGTH];
+    if (txBusy) return false;
+    int length = encodeFrame(frame, data);
+    if (!length) return false;
+    
+    // Put into standby and configure for PTX
+    _ce = 0;
+    setRegister(CONFIG, CONFIG_MASK_RX_DR | CONFIG_MASK_TX_DS | CONFIG_MASK_MAX_RT | CONFIG_EN_CRC | CONFIG_PWR_UP);
+    
     // Write packet data
-    _csn = 0;
-    _spi.write(W_TX_PAYLOAD);
-    _spi.write( (data>>0) & 0xff );
-    _spi.write( (data>>8) & 0xff );
-    _spi.write( (data>>16) & 0xff );
-    _spi.write( (data>>24) & 0xff );
-    _csn = 1;
+    transaction(W_TX_PAYLOAD, data, NULL, length);
+    txFrame = frame.seq;
+    ++stats.sent;
     
-    // Put into PTX and transmit packet
+    // Put into PTX. The packet goes out after Tstby2a; service() sees it
+    // done, with its ACK and any retries.
+    txBusy = true;
+    txStart = _clock.read_us();
     _ce = 1;
-    wait_us(TIMING_Tstby2a);
+    return true;
+}
+
+
+
+bool RadioController::transmit(uint32_t data)
+{
+    radio_frame_t frame;
+    frame.seq = txSeq;
+    frame.types = 1<<MSG_CONTROLLER;
+    frame.controller = data;
+    if (!transmit(frame)) return false;
+    ++txSeq;
+    return true;
+}
+
+
+
+bool RadioController::transmit(uint32_t data, uint32_t superframe)
+{
+    if (!schedule) return transmit(data);
+    if (txBusy) return false;
+    
+    // Hop to the superframe's channel, and tell the robot which one it is
+    int wanted = schedule->channel(superframe);
+    if (wanted != channel)
+    {
+        _ce = 0;
+        setRegister(RF_CH, wanted);
+        channel = wanted;
+    }
+    
+    radio_frame_t frame;
+    frame.seq = txSeq;
+    frame.types = (1<<MSG_CONTROLLER) | (1<<MSG_SYNC);
+    frame.controller = data;
+    frame.superframe = superframe;
+    if (!transmit(frame)) return false;
+    ++txSeq;
+    return true;
+}
+
+
+
+void RadioController::service()
+{
+    if (!txBusy) return;
     
-    // Go back into standby
+    // Done once the packet is out, or acknowledged, or out of retries. Four
+    // retries with ack payloads take under 4 ms.
+    int status = transaction(NOP, NULL, NULL, 0);
+    bool timedOut = (uint32_t)_clock.read_us() - txStart > 4000;
+    if (!(status & (STATUS_TX_DS | STATUS_MAX_RT)) && !timedOut) return;
     _ce = 0;
+    txBusy = false;
+    
+    // Kept by frame counter, for matching up with the robot's latency reports
+    int i = txFrame % TX_HISTORY;
+    doneSeq[i] = txFrame;
+    doneTime[i] = (status & STATUS_TX_DS) ? (uint32_t)_clock.read_us() - txStart : 0;
+    
+    if (link == LINK_ACK_PAYLOAD)
+    {
+        // ARC_CNT is the retries for this frame, PLOS_CNT counts frames that
+        // ran out of them and stops at 15
+        uint8_t observe;
+        transaction(R_REGISTER | OBSERVE_TX, NULL, &observe, 1);
+        int p = observe >> OBSERVE_TX_PLOS_SHIFT;
+        stats.retries += observe & OBSERVE_TX_ARC_CNT_MASK;
+        stats.lost += (p - plos) & 0xf;
+        plos = p;
+        if (plos == 15)
+        {
+            setRegister(RF_CH, channel);
+            plos = 0;
+        }
+        
+        if (status & STATUS_TX_DS)
+        {
+            ++stats.acked;
+            if ((status & STATUS_RN_P_MASK) != STATUS_RN_P_NO_EMPTY) ++stats.ackPayloads;
+        }
+        else
+        {
+            // Given up, or timed out. Drop the frame, the next one is newer.
+            transaction(FLUSH_TX, NULL, NULL, 0);
+        }
+        
+        uint8_t flags = STATUS_TX_DS | STATUS_MAX_RT;
+        transaction(W_REGISTER | STATUS, &flags, NULL, 1);
+        return;
+    }
+    
+    // Clear TX_DS and listen for telemetry
+    uint8_t flags = STATUS_TX_DS;
+    transaction(W_REGISTER | STATUS, &flags, NULL, 1);
+    setRegister(CONFIG, CONFIG_MASK_RX_DR | CONFIG_MASK_TX_DS | CONFIG_MASK_MAX_RT | CONFIG_EN_CRC | CONFIG_PWR_UP | CONFIG_PRIM_RX);
+    _ce = 1;
+}
+
+
+
+void RadioController::resetLinkStats()
+{
+    memset(&stats, 0, sizeof(stats));
+    memset(doneSeq, 0, sizeof(doneSeq));
+    memset(doneTime, 0, sizeof(doneTime));
+}
+
+
+
+uint32_t RadioController::frameTime(uint8_t seq)
+{
+    int i = seq % TX_HISTORY;
+    return doneSeq[i] == seq ? doneTime[i] : 0;
+}
+
+
+
+bool RadioController::receive(radio_frame_t& frame)
+{
+    int status = transaction(NOP, NULL, NULL, 0);
+    
+    while ((status & STATUS_RN_P_MASK) != STATUS_RN_P_NO_EMPTY)
+    {
+        uint8_t data[FRAME_MAX_LENGTH];
+        uint8_t width;
+        transaction(R_RX_PL_WID, NULL, &width, 1);
+        
+        if (width > FRAME_MAX_LENGTH)
+        {
+            transaction(FLUSH_RX, NULL, NULL, 0);
+            ++badFrames;
+            break;
+        }
+        transaction(R_RX_PAYLOAD, NULL, data, width);
+        
+        uint8_t flags = STATUS_RX_DR;
+        status = transaction(W_REGISTER | STATUS, &flags, NULL, 1);
+        
+        if (decodeFrame(data, width, frame)) return true;
+        ++badFrames;
+    }
+    
+    return false;
+}
+
+
+
+int RadioController::transaction(int command, const uint8_t* tx, uint8_t* rx, int length)
+{
+    _csn = 0;
+    int status = _spi.write(command);
+    for (int i = 0; i < length; ++i)
+    {
+        int value = _spi.write(tx ? tx[i] : NOP);
+        if (rx) rx[i] = value;
+    }
+    _csn = 1;
+    return status;
 }
 
 
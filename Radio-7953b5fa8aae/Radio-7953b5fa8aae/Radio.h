@@ -1,9 +1,75 @@
 #ifndef _RADIO_H
 #define _RADIO_H
 
-#include "mbed.h"
+#include "HAL.h"
+#include "SPSCQueue.h"
+#include "RadioProtocol.h"
+#include "RadioSchedule.h"
 
 #define RX_BUFFER_SIZE 4
+#define RX_QUEUE_SIZE 8
+
+// The controller remembers how long this many of its last frames took to go
+// out, for matching up with the latency the robot reports
+#define TX_HISTORY 16
+
+// The controller word drops to 0 if nothing is heard for this long
+#define CONTROLLER_TIMEOUT_US 500000
+
+
+
+// How telemetry gets back to the controller. Both ends have to agree.
+enum radio_link_t
+{
+    LINK_TURNAROUND,    // The robot switches to PTX and sends a frame back
+    LINK_ACK_PAYLOAD    // Telemetry rides on the auto ACK of each controller frame
+};
+
+
+
+// A received payload, stamped by the driver. Decoding is left to poll().
+struct radio_packet_t
+{
+    uint8_t data[FRAME_MAX_LENGTH];
+    uint8_t length;
+    uint8_t pipe;
+    uint16_t seq;       // Counts every packet received, including dropped ones
+    uint32_t time;      // When the IRQ fired, microseconds on the radio's clock
+};
+
+
+
+// Everything the main loop needs from the radio, updated in one go by poll()
+struct radio_state_t
+{
+    uint32_t controller;            // Latest controller word, 0 once timed out
+    uint32_t controllerTime;
+    uint16_t controllerSeq;
+    uint8_t controllerFrame;        // The controller's frame counter
+    unsigned int controllerLost;    // Gaps in the controller's frame counter
+    radio_frame_t robot[RX_BUFFER_SIZE]; // Latest frames from other robots
+    uint8_t robotPipe[RX_BUFFER_SIZE];   // And the pipes they came in on
+    unsigned int robotPos;
+    unsigned int received;
+    unsigned int overruns;          // Packets dropped because the queue was full
+    unsigned int badFrames;         // Packets that did not decode
+    unsigned int ackPayloads;       // Telemetry frames sent back on an ACK
+    int channel;
+    bool synced;                    // Following the controller's hop sequence
+};
+
+
+
+// Link quality as seen by the controller, from OBSERVE_TX after each frame.
+// Only sent is counted when the link has no ACKs.
+struct link_stats_t
+{
+    unsigned int sent;
+    unsigned int acked;
+    unsigned int lost;          // No ACK after every retry, from PLOS_CNT
+    unsigned int retries;       // Retransmissions, from ARC_CNT
+    unsigned int ackPayloads;   // ACKs that carried telemetry
+};
 
 
 
@@ -11,26 +77,82 @@ class Radio
 {
 public:
     Radio(PinName mosi, PinName miso, PinName sck, PinName csn, PinName ce, PinName irq);
-    void reset();
-    void transmit(uint32_t data);
+    
+    // With a schedule the robot follows its controller's hop sequence and
+    // listens on all six pipes. Call before reset(); NULL goes back to the
+    // fixed channel and pipes 0 and 1.
+    void setSchedule(const ArenaSchedule* schedule) { this->schedule = schedule; }
+    void reset(radio_link_t link = LINK_TURNAROUND);
+    
+    // Bottom half of the driver. The IRQ handler only flags that the chip
+    // wants attention; call this from the main loop, outside the control
+    // tick, to read received packets and finish transmissions.
+    void service();
+    
+    // Starts sending a packet and returns straight away. Returns false if the
+    // last one is still going out. The radio listens again, and the transmit
+    // done callback is called, from service() once it has been sent.
+    bool transmit(const uint8_t* data, int length);
+    bool transmit(const radio_frame_t& frame);
+    bool transmitting() { return txBusy; }
+    void attachTransmitDone(void (*function)()) { txDone.attach(function); }
+    
+    template<typename T>
+    void attachTransmitDone(T* object, void (T::*member)()) { txDone.attach(object, member); }
+    
+    // With LINK_ACK_PAYLOAD, queues a frame to go back on the ACK of the next
+    // controller frame, without leaving PRX. Returns false while the last one
+    // is still waiting.
+    bool setAckPayload(const radio_frame_t& frame);
+    bool ackPending() { return ackWaiting; }
+    
+    // Consumer side. Takes everything received since the last call and
+    // returns a snapshot that stays consistent until the next one.
+    const radio_state_t& poll();
+    
+    // Microseconds on the clock packets are stamped with
+    uint32_t time() { return _clock.read_us(); }
+    
     int getRegister(int address);
     int getStatus();
     
-    uint32_t rx_controller;
-    uint32_t rx_robot[RX_BUFFER_SIZE];
     int controller;
 
 private:
     void setRegister(int address, int data);
-    void receive();
-    void clear();
+    int transaction(int command, const uint8_t* tx, uint8_t* rx, int length);
+    void interrupt();
+    void transmitDone();
+    void hop();
+    void sync(const radio_packet_t& packet);
 
     SPI _spi;
     DigitalOut _csn;
     DigitalOut _ce;
     InterruptIn _irq;
-    Timeout clearTimeout;
-    unsigned rx_robot_pos;
+    Timer _clock;
+    
+    // Filled by service(), drained by poll()
+    SPSCQueue<radio_packet_t, RX_QUEUE_SIZE> rxQueue;
+    uint16_t rxSeq;
+    radio_state_t state;
+    int lastControllerFrame;    // Frame counter, -1 before the first
+    
+    volatile bool irqPending;
+    volatile uint32_t irqTime;
+    volatile bool txBusy;
+    volatile bool ackWaiting;
+    volatile unsigned int acksSent;
+    radio_link_t link;
+    int config;
+    FunctionPointer txDone;
+    
+    // Hop state, owned by service()
+    const ArenaSchedule* schedule;
+    volatile int channel;
+    volatile bool synced;
+    uint32_t syncFrame;     // Superframe of the last controller frame
+    uint32_t syncTime;      // And when it arrived
 };
 
 
@@ -39,17 +161,62 @@ class RadioController
 {
 public:
     RadioController(PinName mosi, PinName miso, PinName sck, PinName csn, PinName ce);
-    void reset();
-    void transmit(uint32_t data);
+    
+    // With a schedule the controller sends on the pair's hop sequence, and
+    // its address comes from the pair. Call before reset(); NULL goes back
+    // to the fixed channel.
+    void setSchedule(const ArenaSchedule* schedule) { this->schedule = schedule; }
+    void reset(radio_link_t link = LINK_TURNAROUND);
+    
+    // Starts sending a frame and returns straight away. Returns false if the
+    // last one is still going out. service() finishes it: with
+    // LINK_TURNAROUND the radio then listens for telemetry until the next
+    // one; with LINK_ACK_PAYLOAD the telemetry comes back on the ACK, with up
+    // to three retries.
+    bool transmit(const radio_frame_t& frame);
+    bool transmit(uint32_t data);
+    
+    // Sends in a superframe of the schedule, which the caller starts at
+    // schedule->slotStart(superframe) on its clock
+    bool transmit(uint32_t data, uint32_t superframe);
+    
+    void service();
+    bool transmitting() { return txBusy; }
+    
+    // Takes the next telemetry frame from the RX FIFO. Returns false if there
+    // is none; frames that do not decode are counted and skipped.
+    bool receive(radio_frame_t& frame);
+    
+    const link_stats_t& linkStats() { return stats; }
+    void resetLinkStats();
+    
+    // Microseconds from transmit() to the ACK, or to the end of the packet
+    // without ACKs, of one of the last TX_HISTORY frames. 0 if it did not get
+    // through or is too old.
+    uint32_t frameTime(uint8_t seq);
     
     int controller;
+    unsigned int badFrames;
 
 private:
     void setRegister(int address, int data);
+    int transaction(int command, const uint8_t* tx, uint8_t* rx, int length);
     
     SPI _spi;
     DigitalOut _csn;
     DigitalOut _ce;
+    Timer _clock;
+    uint8_t txSeq;
+    bool txBusy;
+    uint32_t txStart;
+    uint8_t txFrame;
+    uint8_t doneSeq[TX_HISTORY];
+    uint32_t doneTime[TX_HISTORY];
+    radio_link_t link;
+    link_stats_t stats;
+    int plos;
+    const ArenaSchedule* schedule;
+    int channel;
 };
 
 
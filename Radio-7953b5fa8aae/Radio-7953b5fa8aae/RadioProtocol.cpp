@@ -0,0 +1,168 @@
+#include "RadioProtocol.h"
+
+
+
+// Body length of each message type, 0 for unused types
+static const uint8_t messageLength[MSG_TYPES] = { 0, 4, 24, 8, 6, 2, 7 };
+
+
+
+static void put16(uint8_t*& p, uint16_t value)
+{
+    *p++ = value & 0xff;
+    *p++ = value >> 8;
+}
+
+
+
+static uint16_t get16(const uint8_t*& p)
+{
+    uint16_t value = p[0] | (p[1]<<8);
+    p += 2;
+    return value;
+}
+
+
+
+int frameLength(unsigned int types)
+{
+    int length = 1;
+    for (int type = 1; type < MSG_TYPES; ++type)
+    {
+        if (types & (1<<type)) length += 1 + messageLength[type];
+    }
+    return length;
+}
+
+
+
+int encodeFrame(const radio_frame_t& frame, uint8_t* data)
+{
+    int length = frameLength(frame.types);
+    if (length > FRAME_MAX_LENGTH || (frame.types & ~((1<<MSG_TYPES) - 2))) return 0;
+
+    uint8_t* p = data;
+    *p++ = frame.seq;
+
+    if (frame.types & (1<<MSG_CONTROLLER))
+    {
+        *p++ = MSG_CONTROLLER;
+        put16(p, frame.controller & 0xffff);
+        put16(p, frame.controller >> 16);
+    }
+
+    if (frame.types & (1<<MSG_FEET))
+    {
+        *p++ = MSG_FEET;
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+                put16(p, frame.feet[i][j]);
+        }
+    }
+
+    if (frame.types & (1<<MSG_STABILITY))
+    {
+        *p++ = MSG_STABILITY;
+        for (int i = 0; i < 4; ++i)
+            put16(p, frame.stability[i]);
+    }
+
+    if (frame.types & (1<<MSG_TIMING))
+    {
+        *p++ = MSG_TIMING;
+        put16(p, frame.period);
+        put16(p, frame.tick);
+        put16(p, frame.tickMax);
+    }
+
+    if (frame.types & (1<<MSG_SYNC))
+    {
+        *p++ = MSG_SYNC;
+        put16(p, frame.superframe);
+    }
+
+    if (frame.types & (1<<MSG_LATENCY))
+    {
+        *p++ = MSG_LATENCY;
+        *p++ = frame.latencyFrame;
+        put16(p, frame.latency);
+        put16(p, frame.latencyP99);
+        put16(p, frame.latencyMax);
+    }
+
+    return length;
+}
+
+
+
+bool decodeFrame(const uint8_t* data, int length, radio_frame_t& frame)
+{
+    if (length < 1 || length > FRAME_MAX_LENGTH) return false;
+
+    const uint8_t* p = data;
+    const uint8_t* end = data + length;
+    int last = 0;
+
+    frame.seq = *p++;
+    frame.types = 0;
+
+    while (p < end)
+    {
+        int type = *p++;
+        if (type <= last || type >= MSG_TYPES || end - p < messageLength[type]) return false;
+        last = type;
+
+        switch (type)
+        {
+        case MSG_CONTROLLER:
+            frame.controller = get16(p);
+            frame.controller |= (uint32_t)get16(p) << 16;
+            break;
+
+        case MSG_FEET:
+            for (int i = 0; i < 4; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                    frame.feet[i][j] = (int16_t)get16(p);
+            }
+            break;
+
+        case MSG_STABILITY:
+            for (int i = 0; i < 4; ++i)
+                frame.stability[i] = (int16_t)get16(p);
+            break;
+
+        case MSG_TIMING:
+            frame.period = get16(p);
+            frame.tick = get16(p);
+            frame.tickMax = get16(p);
+            break;
+
+        case MSG_SYNC:
+            frame.superframe = get16(p);
+            break;
+
+        case MSG_LATENCY:
+            frame.latencyFrame = *p++;
+            frame.latency = get16(p);
+            frame.latencyP99 = get16(p);
+            frame.latencyMax = get16(p);
+            break;
+        }
+
+        frame.types |= 1<<type;
+    }
+
+    return true;
+}
+
+
+
+int16_t frameUnits(float metres)
+{
+    float units = metres * FRAME_UNITS_PER_M;
+    if (units >= 32767.0f) return 32767;
+    if (!(units > -32768.0f)) return -32768; // Also catches NaN
+    return (int16_t)(units < 0.0f ? units - 0.5f : units + 0.5f);
+}
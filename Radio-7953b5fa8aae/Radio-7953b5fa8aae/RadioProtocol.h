@@ -0,0 +1,62 @@
+#ifndef _RADIOPROTOCOL_H
+#define _RADIOPROTOCOL_H
+
+#include "HAL.h"
+
+// Frames are sent as nRF24L01+ dynamic payloads of up to 32 bytes. The first
+// byte is a frame counter, then any number of messages, each a type byte and a
+// body whose length is fixed by the type. Messages are written in increasing
+// type order and each type appears at most once, so a frame has exactly one
+// encoding. All values are little endian.
+#define FRAME_MAX_LENGTH 32
+
+// Message types
+#define MSG_CONTROLLER  1   // uint32_t controller word
+#define MSG_FEET        2   // int16_t[4][3] foot positions, robot coordinates
+#define MSG_STABILITY   3   // int16_t[4] stability margins
+#define MSG_TIMING      4   // uint16_t period, tick and worst tick since last, in us
+#define MSG_SYNC        5   // uint16_t arena superframe the frame was sent in
+#define MSG_LATENCY     6   // uint8_t controller frame last applied, uint16_t its latency, p99 and max, in us
+#define MSG_TYPES       7
+
+// Lengths are sent in units of 0.1 mm
+#define FRAME_UNITS_PER_M 10000.0f
+
+
+
+// Every field a frame can carry. Only the messages flagged in types are
+// valid.
+struct radio_frame_t
+{
+    uint8_t seq;
+    uint8_t types;          // Bit (1<<type) for each message present
+    uint32_t controller;
+    int16_t feet[4][3];
+    int16_t stability[4];
+    uint16_t period;
+    uint16_t tick;
+    uint16_t tickMax;
+    uint16_t superframe;
+    uint8_t latencyFrame;
+    uint16_t latency;
+    uint16_t latencyP99;
+    uint16_t latencyMax;
+};
+
+
+
+// Bytes needed for a frame carrying the messages in types
+int frameLength(unsigned int types);
+
+// Writes the messages flagged in frame.types. Returns the length, or 0 if
+// they do not fit in one frame.
+int encodeFrame(const radio_frame_t& frame, uint8_t* data);
+
+// Returns false, leaving frame undefined, for an unknown type, a truncated
+// body or messages out of order
+bool decodeFrame(const uint8_t* data, int length, radio_frame_t& frame);
+
+// Converts a length in metres to frame units, saturating
+int16_t frameUnits(float metres);
+
+#endif // _RADIOPROTOCOL_H
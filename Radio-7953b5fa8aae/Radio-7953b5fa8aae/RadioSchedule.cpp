@@ -0,0 +1,40 @@
+#include "RadioSchedule.h"
+
+
+
+// Channels 2400 + n MHz are only in the 2.4 GHz ISM band up to 83. Wrapping
+// each table entry in this fails the build for one that is out of band.
+#define ARENA_MAX_CHANNEL 83
+
+template<int n>
+struct BandChannel
+{
+    typedef char in_band_check[n >= 0 && n <= ARENA_MAX_CHANNEL ? 1 : -1];
+    enum { value = n };
+};
+
+// Hop channels in the gaps between WiFi channels 1, 6 and 11, at 2424-2425
+// and 2449-2450 MHz, and above 11 from 2474 MHz. Neighbours in the sequence
+// are far apart.
+static const uint8_t hopTable[ARENA_HOPS] =
+{
+    BandChannel<78>::value, BandChannel<49>::value, BandChannel<74>::value, BandChannel<24>::value,
+    BandChannel<82>::value, BandChannel<50>::value, BandChannel<80>::value, BandChannel<25>::value
+};
+
+
+
+ArenaSchedule::ArenaSchedule(int pair, int team)
+: _pair(pair % ARENA_PAIRS), _team(team)
+{
+}
+
+
+
+int ArenaSchedule::channel(uint32_t superframe) const
+{
+    // Pairs in the same slot are two steps apart in the sequence. Pairs in
+    // neighbouring slots are offset too, in case the controllers drift.
+    int group = _pair / ARENA_SLOTS;
+    return hopTable[(superframe + 2*group + slot()) % ARENA_HOPS];
+}
@@ -0,0 +1,52 @@
+#ifndef _RADIOSCHEDULE_H
+#define _RADIOSCHEDULE_H
+
+#include "HAL.h"
+
+// Arena schedule for up to 16 controller/robot pairs. Time is split into
+// superframes of one controller period, each with ARENA_SLOTS TDMA slots. A
+// controller sends one frame at the start of its slot, and every pair hops
+// to a new channel each superframe. The pairs sharing a slot are ARENA_SLOTS
+// apart and start at different points of the hop sequence, so at any time
+// they are on different channels.
+#define ARENA_FRAME_US  20000
+#define ARENA_SLOTS     4
+#define ARENA_SLOT_US   (ARENA_FRAME_US/ARENA_SLOTS)
+#define ARENA_HOPS      8
+#define ARENA_PAIRS     16
+
+// The robot drops sync after missing this many superframes, and parks on
+// the first channel of its sequence, where the controller comes by once
+// every ARENA_HOPS superframes
+#define ARENA_SYNC_FRAMES 8
+
+// Low address bytes of robot pipes 2-5, which share the upper bytes of the
+// all robots address on pipe 1
+#define ARENA_ROBOT_LSB     0x10    // Plus pair, this robot only
+#define ARENA_TEAM_LSB      0x30    // Plus team, every robot in the team
+#define ARENA_REFEREE_LSB   0x40    // Arena referee broadcasts
+#define ARENA_PIT_LSB       0x50    // Plus pair, link to the pit computer
+
+
+
+class ArenaSchedule
+{
+public:
+    ArenaSchedule(int pair, int team = 0);
+
+    int pair() const { return _pair; }
+    int team() const { return _team; }
+    int slot() const { return _pair % ARENA_SLOTS; }
+
+    // Channel for a superframe
+    int channel(uint32_t superframe) const;
+
+    // Start of the pair's slot in a superframe, on the arena clock
+    uint32_t slotStart(uint32_t superframe) const { return superframe*ARENA_FRAME_US + slot()*ARENA_SLOT_US; }
+
+private:
+    int _pair;
+    int _team;
+};
+
+#endif // _RADIOSCHEDULE_H
@@ -0,0 +1,70 @@
+#ifndef _SPSCQUEUE_H
+#define _SPSCQUEUE_H
+
+#include "HAL.h"
+
+// Orders slot accesses against the index updates that hand the slot over. A
+// single core Cortex-M3 only needs the compiler not to reorder, which the DMB
+// also gives.
+#ifdef HAL_POSIX
+#define SPSC_BARRIER() __sync_synchronize()
+#else
+#define SPSC_BARRIER() __DMB()
+#endif
+
+
+
+// Wait-free queue between one producer and one consumer, e.g. an interrupt
+// and the main loop. Size must be a power of two. The indices run freely and
+// only the producer writes head, only the consumer writes tail.
+template<typename T, unsigned int Size>
+class SPSCQueue
+{
+public:
+    SPSCQueue() : overruns(0), head(0), tail(0) {}
+
+    // Producer side. Drops the item and counts an overrun if the queue is full.
+    bool push(const T& item)
+    {
+        unsigned int h = head;
+        if (h - tail >= Size)
+        {
+            ++overruns;
+            return false;
+        }
+
+        SPSC_BARRIER();
+        items[h & (Size - 1)] = item;
+        SPSC_BARRIER();
+        head = h + 1;
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item)
+    {
+        unsigned int t = tail;
+        if (t == head) return false;
+
+        SPSC_BARRIER();
+        item = items[t & (Size - 1)];
+        SPSC_BARRIER();
+        tail = t + 1;
+        return true;
+    }
+
+    unsigned int count() const { return head - tail; }
+
+    // Written by the producer only
+    volatile unsigned int overruns;
+
+private:
+    volatile unsigned int head;
+    volatile unsigned int tail;
+    T items[Size];
+
+    // Fails to compile unless Size is a power of two
+    typedef char sizeIsPowerOfTwo[(Size && !(Size & (Size - 1))) ? 1 : -1];
+};
+
+#endif // _SPSCQUEUE_H
@@ -76,6 +76,10 @@
 #define SETUP_AW_4BYTES 0x02
 #define SETUP_AW_5BYTES 0x03
 
+// SETUP_RETR fields. The retransmit delay is (ARD + 1)*250 us.
+#define SETUP_RETR_ARD_SHIFT    4
+#define SETUP_RETR_ARC_MASK     0x0f
+
 // RF_SETUP bits
 #define RF_SETUP_CONT_WAVE   (1<<7)
 #define RF_SETUP_RF_DR_LOW   (1<<5)
@@ -100,6 +104,10 @@
 #define STATUS_RN_P_NO_EMPTY    (0x7<<1)
 #define STATUS_TX_FULL          (1<<0)
 
+// OBSERVE_TX fields. PLOS_CNT stops at 15 and is reset by writing RF_CH.
+#define OBSERVE_TX_PLOS_SHIFT   4
+#define OBSERVE_TX_ARC_CNT_MASK 0x0f
+
 // FIFO_STATUS bits
 #define FIFO_STATUS_TX_REUSE    (1<<6)
 #define FIFO_STATUS_TX_FULL     (1<<5)
@@ -0,0 +1,487 @@
+#ifdef HAL_POSIX
+
+#include "nRF24L01P_sim.h"
+#include "nRF24L01P_defs.h"
+
+
+
+nRF24L01P_sim::nRF24L01P_sim(PinName sck, PinName csn, PinName ce, PinName irq)
+: _csn(csn), _ce(ce), _irq(irq), _sck(sck)
+{
+    // Power on reset values
+    memset(_reg, 0, sizeof(_reg));
+    _reg[CONFIG] = CONFIG_EN_CRC;
+    _reg[EN_AA] = 0x3f;
+    _reg[EN_RXADDR] = ERX_P0 | ERX_P1;
+    _reg[SETUP_AW] = SETUP_AW_5BYTES;
+    _reg[SETUP_RETR] = 0x03;
+    _reg[RF_CH] = 0x02;
+    _reg[RF_SETUP] = RF_SETUP_RF_DR_HIGH | RF_SETUP_RF_PWR_0;
+    _reg[RX_ADDR_P2] = 0xc3;
+    _reg[RX_ADDR_P3] = 0xc4;
+    _reg[RX_ADDR_P4] = 0xc5;
+    _reg[RX_ADDR_P5] = 0xc6;
+    memset(_rxAddr[0], 0xe7, 5);
+    memset(_rxAddr[1], 0xc2, 5);
+    memset(_txAddr, 0xe7, 5);
+
+    _rx.count = 0;
+    _tx.count = 0;
+    _command = -1;
+    _index = 0;
+    _transmitting = false;
+    _arcCnt = 0;
+    _plosCnt = 0;
+    _air = NULL;
+    overflows = 0;
+
+    SimSPI::attach(_sck, this);
+    SimPins::listen(_csn, this);
+    SimPins::listen(_ce, this);
+    updateIrq();
+}
+
+
+
+nRF24L01P_sim::~nRF24L01P_sim()
+{
+    SimSPI::detach(_sck, this);
+    SimPins::unlisten(_csn, this);
+    SimPins::unlisten(_ce, this);
+}
+
+
+
+void nRF24L01P_sim::setAir(SimAir* air)
+{
+    _air = air;
+}
+
+
+
+bool nRF24L01P_sim::receivePacket(int channel, const uint8_t* address, int addressWidth, const uint8_t* data, int length,
+                                  uint8_t* ack, int* ackLength)
+{
+    int pipe;
+
+    if (ackLength) *ackLength = -1;
+
+    // Must be powered up, in PRX and enabled
+    if (!(_reg[CONFIG] & CONFIG_PWR_UP) || !(_reg[CONFIG] & CONFIG_PRIM_RX) || !SimPins::read(_ce))
+        return false;
+    if (channel != _reg[RF_CH] || !matchPipe(address, addressWidth, &pipe))
+        return false;
+
+    if (_rx.count >= SIM_FIFO_DEPTH)
+    {
+        ++overflows;
+        return false;
+    }
+
+    payload_t p;
+    p.pipe = pipe;
+    p.length = payloadWidth(pipe, length);
+    memset(p.data, 0, SIM_MAX_PAYLOAD);
+    memcpy(p.data, data, length < p.length ? length : p.length);
+    push(_rx, p);
+    _reg[STATUS] |= STATUS_RX_DR;
+
+    // Auto acknowledge, with the first ack payload written for this pipe.
+    // TX_DS tells the receiver that payload has gone.
+    if (_reg[EN_AA] & (1<<pipe))
+    {
+        int n = 0;
+        for (int i = 0; i < _tx.count && (_reg[FEATURE] & FEATURE_EN_ACK_PAY); ++i)
+        {
+            if (_tx.entries[i].pipe != pipe) continue;
+
+            n = _tx.entries[i].length;
+            if (ack) memcpy(ack, _tx.entries[i].data, n);
+            for (int j = i + 1; j < _tx.count; ++j)
+                _tx.entries[j - 1] = _tx.entries[j];
+            --_tx.count;
+            _reg[STATUS] |= STATUS_TX_DS;
+            break;
+        }
+        if (ackLength) *ackLength = n;
+    }
+
+    updateIrq();
+    return true;
+}
+
+
+
+int nRF24L01P_sim::getRegister(int address)
+{
+    address &= REGISTER_ADDRESS_MASK;
+
+    switch (address)
+    {
+    case STATUS:
+        return getStatus();
+
+    case OBSERVE_TX:
+        return (_plosCnt << OBSERVE_TX_PLOS_SHIFT) | _arcCnt;
+
+    case FIFO_STATUS:
+        return (_rx.count == 0 ? FIFO_STATUS_RX_EMPTY : 0) |
+               (_rx.count == SIM_FIFO_DEPTH ? FIFO_STATUS_RX_FULL : 0) |
+               (_tx.count == 0 ? FIFO_STATUS_TX_EMPTY : 0) |
+               (_tx.count == SIM_FIFO_DEPTH ? FIFO_STATUS_TX_FULL : 0);
+
+    case RX_ADDR_P0:
+        return _rxAddr[0][0];
+
+    case RX_ADDR_P1:
+        return _rxAddr[1][0];
+
+    case TX_ADDR:
+        return _txAddr[0];
+
+    default:
+        return _reg[address];
+    }
+}
+
+
+
+int nRF24L01P_sim::getStatus()
+{
+    int pipe = _rx.count ? _rx.entries[0].pipe : 7;
+    return (_reg[STATUS] & (STATUS_RX_DR | STATUS_TX_DS | STATUS_MAX_RT)) |
+           (pipe << 1) |
+           (_tx.count == SIM_FIFO_DEPTH ? STATUS_TX_FULL : 0);
+}
+
+
+
+bool nRF24L01P_sim::selected()
+{
+    return !SimPins::read(_csn);
+}
+
+
+
+int nRF24L01P_sim::transfer(int value)
+{
+    // The first byte of every transaction is a command, and clocks out STATUS
+    if (_command < 0)
+    {
+        _command = value;
+        _index = 0;
+        _buffer.length = 0;
+        return getStatus();
+    }
+
+    int index = _index++;
+    int address = _command & REGISTER_ADDRESS_MASK;
+
+    if ((_command & 0xe0) == R_REGISTER)
+    {
+        if (address == RX_ADDR_P0 || address == RX_ADDR_P1 || address == TX_ADDR)
+        {
+            const uint8_t* a = (address == TX_ADDR) ? _txAddr : _rxAddr[address - RX_ADDR_P0];
+            return index < 5 ? a[index] : 0;
+        }
+        return index == 0 ? getRegister(address) : 0;
+    }
+
+    if ((_command & 0xe0) == W_REGISTER)
+    {
+        if (address == RX_ADDR_P0 || address == RX_ADDR_P1 || address == TX_ADDR)
+        {
+            uint8_t* a = (address == TX_ADDR) ? _txAddr : _rxAddr[address - RX_ADDR_P0];
+            if (index < 5) a[index] = value;
+        }
+        else if (index == 0)
+        {
+            switch (address)
+            {
+            case STATUS:
+                // Interrupt flags are cleared by writing 1
+                _reg[STATUS] &= ~(value & (STATUS_RX_DR | STATUS_TX_DS | STATUS_MAX_RT));
+                updateIrq();
+                break;
+
+            case FIFO_STATUS:
+            case OBSERVE_TX:
+            case RPD:
+                // Read only
+                break;
+
+            case RF_CH:
+                // Changing channel restarts the lost packet count
+                _reg[RF_CH] = value;
+                _plosCnt = 0;
+                break;
+
+            default:
+                _reg[address] = value;
+                if (address == CONFIG) updateIrq();
+                break;
+            }
+        }
+        return 0;
+    }
+
+    switch (_command)
+    {
+    case R_RX_PAYLOAD:
+        _buffer.length = index + 1;
+        return (_rx.count && index < _rx.entries[0].length) ? _rx.entries[0].data[index] : 0;
+
+    case R_RX_PL_WID:
+        return _rx.count ? _rx.entries[0].length : 0;
+
+    case W_TX_PAYLOAD:
+    case W_TX_PAYLOAD_NOACK:
+        if (index < SIM_MAX_PAYLOAD)
+        {
+            _buffer.data[index] = value;
+            _buffer.length = index + 1;
+        }
+        return 0;
+
+    default:
+        // Ack payloads carry their pipe in the command
+        if ((_command & ~PIPE_MASK) == W_ACK_PAYLOAD && index < SIM_MAX_PAYLOAD)
+        {
+            _buffer.data[index] = value;
+            _buffer.length = index + 1;
+        }
+        return 0;
+    }
+}
+
+
+
+void nRF24L01P_sim::pinChanged(PinName pin, int value)
+{
+    if (pin == _csn && value)
+    {
+        endCommand();
+    }
+    else if (pin == _ce && value)
+    {
+        startTransmit();
+    }
+}
+
+
+
+void nRF24L01P_sim::endCommand()
+{
+    switch (_command)
+    {
+    case R_RX_PAYLOAD:
+        if (_buffer.length > 0 && _rx.count) pop(_rx);
+        break;
+
+    case W_TX_PAYLOAD:
+    case W_TX_PAYLOAD_NOACK:
+        if (_buffer.length > 0 && _tx.count < SIM_FIFO_DEPTH)
+        {
+            _buffer.pipe = 0;
+            _buffer.noAck = (_command == W_TX_PAYLOAD_NOACK);
+            push(_tx, _buffer);
+            if (SimPins::read(_ce)) startTransmit();
+        }
+        break;
+
+    case FLUSH_TX:
+        _tx.count = 0;
+        break;
+
+    case FLUSH_RX:
+        _rx.count = 0;
+        break;
+
+    default:
+        if ((_command & ~PIPE_MASK) == W_ACK_PAYLOAD && (_reg[FEATURE] & FEATURE_EN_ACK_PAY) &&
+            _buffer.length > 0 && _tx.count < SIM_FIFO_DEPTH)
+        {
+            _buffer.pipe = _command & PIPE_MASK;
+            _buffer.noAck = true;
+            push(_tx, _buffer);
+        }
+        break;
+    }
+
+    _command = -1;
+    updateIrq();
+}
+
+
+
+void nRF24L01P_sim::startTransmit()
+{
+    // PTX sends the head of the TX FIFO once CE is pulsed. MAX_RT stops it
+    // until the flag is cleared.
+    if (_transmitting || _tx.count == 0) return;
+    if (!(_reg[CONFIG] & CONFIG_PWR_UP) || (_reg[CONFIG] & CONFIG_PRIM_RX)) return;
+    if (_reg[STATUS] & STATUS_MAX_RT) return;
+
+    _transmitting = true;
+    _arcCnt = 0;
+    _txTimeout.attach(this, &nRF24L01P_sim::transmitDone, airTime(_tx.entries[0].length) * 0.000001f);
+}
+
+
+
+void nRF24L01P_sim::transmitDone()
+{
+    _transmitting = false;
+    if (_tx.count == 0) return;
+
+    payload_t p = _tx.entries[0];
+    bool wantAck = (_reg[EN_AA] & ENAA_P0) && !p.noAck;
+    int ackLength = -1;
+    bool acked = false;
+
+    if (_air) acked = _air->transmitted(this, _reg[RF_CH], _txAddr, addressWidth(), p.data, p.length, _ack.data, &ackLength);
+
+    if (!wantAck)
+    {
+        pop(_tx);
+        _reg[STATUS] |= STATUS_TX_DS;
+        updateIrq();
+
+        // Keep going while CE is held high in PTX
+        if (SimPins::read(_ce)) startTransmit();
+        return;
+    }
+
+    // The ACK comes back after the receiver turns around, and is missed if
+    // it takes longer than the retransmit delay
+    int delay = ((_reg[SETUP_RETR] >> SETUP_RETR_ARD_SHIFT) + 1) * 250;
+    _transmitting = true;
+    if (acked && ackLength >= 0 && airTime(ackLength) <= delay)
+    {
+        _ack.length = ackLength;
+        _ack.pipe = 0;
+        _txTimeout.attach(this, &nRF24L01P_sim::ackReceived, airTime(ackLength) * 0.000001f);
+    }
+    else if (_arcCnt < (_reg[SETUP_RETR] & SETUP_RETR_ARC_MASK))
+    {
+        ++_arcCnt;
+        _txTimeout.attach(this, &nRF24L01P_sim::transmitDone, (delay + airTime(p.length)) * 0.000001f);
+    }
+    else
+    {
+        // Given up. The packet stays in the TX FIFO.
+        _transmitting = false;
+        if (_plosCnt < 15) ++_plosCnt;
+        _reg[STATUS] |= STATUS_MAX_RT;
+        updateIrq();
+    }
+}
+
+
+
+void nRF24L01P_sim::ackReceived()
+{
+    _transmitting = false;
+    if (_tx.count) pop(_tx);
+
+    // An ack payload is received on pipe 0 like any other packet
+    if (_ack.length > 0)
+    {
+        if (_rx.count < SIM_FIFO_DEPTH)
+        {
+            push(_rx, _ack);
+            _reg[STATUS] |= STATUS_RX_DR;
+        }
+        else ++overflows;
+    }
+
+    _reg[STATUS] |= STATUS_TX_DS;
+    updateIrq();
+
+    if (SimPins::read(_ce)) startTransmit();
+}
+
+
+
+// Settling time plus air time at 2 Mbps: preamble, address, payload, CRC and
+// the 9 bit packet control field
+int nRF24L01P_sim::airTime(int length)
+{
+    int crc = (_reg[CONFIG] & CONFIG_EN_CRC) ? ((_reg[CONFIG] & CONFIG_CRC0) ? 2 : 1) : 0;
+    int bits = (1 + addressWidth() + length + crc)*8 + 9;
+    return TIMING_Tstby2a + bits/2;
+}
+
+
+
+void nRF24L01P_sim::updateIrq()
+{
+    int mask = 0;
+    if (!(_reg[CONFIG] & CONFIG_MASK_RX_DR)) mask |= STATUS_RX_DR;
+    if (!(_reg[CONFIG] & CONFIG_MASK_TX_DS)) mask |= STATUS_TX_DS;
+    if (!(_reg[CONFIG] & CONFIG_MASK_MAX_RT)) mask |= STATUS_MAX_RT;
+
+    // Active low. Chip select has to be released before the pin is updated
+    // so an interrupt handler can talk to the chip straight away.
+    if (_command < 0) SimPins::write(_irq, (_reg[STATUS] & mask) ? 0 : 1);
+}
+
+
+
+int nRF24L01P_sim::addressWidth()
+{
+    int aw = _reg[SETUP_AW] & 0x03;
+    return aw ? aw + 2 : 5;
+}
+
+
+
+int nRF24L01P_sim::payloadWidth(int pipe, int length)
+{
+    if ((_reg[FEATURE] & FEATURE_EN_DPL) && (_reg[DYNPD] & (1<<pipe)))
+        return length > SIM_MAX_PAYLOAD ? SIM_MAX_PAYLOAD : length;
+    return _reg[RX_PW_P0 + pipe] & 0x3f;
+}
+
+
+
+bool nRF24L01P_sim::matchPipe(const uint8_t* address, int addressWidth, int* pipe)
+{
+    int aw = this->addressWidth();
+    if (addressWidth != aw) return false;
+
+    for (int i = 0; i < 6; ++i)
+    {
+        if (!(_reg[EN_RXADDR] & (1<<i))) continue;
+
+        // Pipes 2-5 share the upper address bytes of pipe 1
+        const uint8_t* base = (i == 0) ? _rxAddr[0] : _rxAddr[1];
+        uint8_t lsb = (i < 2) ? base[0] : _reg[RX_ADDR_P0 + i];
+
+        if (address[0] == lsb && memcmp(address + 1, base + 1, aw - 1) == 0)
+        {
+            *pipe = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+
+void nRF24L01P_sim::push(fifo_t& fifo, const payload_t& p)
+{
+    fifo.entries[fifo.count++] = p;
+}
+
+
+
+void nRF24L01P_sim::pop(fifo_t& fifo)
+{
+    for (int i = 1; i < fifo.count; ++i)
+        fifo.entries[i - 1] = fifo.entries[i];
+    --fifo.count;
+}
+
+#endif // HAL_POSIX
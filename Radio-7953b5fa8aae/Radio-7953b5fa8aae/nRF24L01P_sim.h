@@ -0,0 +1,107 @@
+#ifndef _NRF24L01P_SIM_H
+#define _NRF24L01P_SIM_H
+
+#ifdef HAL_POSIX
+
+#include "HAL.h"
+
+#define SIM_FIFO_DEPTH  3
+#define SIM_MAX_PAYLOAD 32
+
+
+
+class nRF24L01P_sim;
+
+// Shared radio medium. Gets every packet a simulated radio puts on the air.
+// Returns true if a receiver acknowledged it, with the ack payload length in
+// ackLength (0 for a plain ACK) and its data in ack.
+class SimAir
+{
+public:
+    virtual ~SimAir() {}
+    virtual bool transmitted(nRF24L01P_sim* from, int channel, const uint8_t* address, int addressWidth,
+                             const uint8_t* data, int length, uint8_t* ack, int* ackLength) = 0;
+};
+
+
+
+// In-memory register model of an nRF24L01+ for host builds. Sits on the
+// simulated SPI bus and watches its CSN/CE pins like the real chip, and drives
+// its IRQ pin active low.
+class nRF24L01P_sim : public SimSPIDevice, public SimPinListener
+{
+public:
+    nRF24L01P_sim(PinName sck, PinName csn, PinName ce, PinName irq);
+    ~nRF24L01P_sim();
+
+    // Deliver a packet over the air. Returns false if it was not accepted
+    // because the radio is not listening, no pipe matches or the RX FIFO is full.
+    // If the pipe has auto acknowledge on, ackLength is set to the length of
+    // the ACK payload sent back, taken from ack payloads written for the pipe,
+    // and to -1 otherwise.
+    bool receivePacket(int channel, const uint8_t* address, int addressWidth, const uint8_t* data, int length,
+                       uint8_t* ack = NULL, int* ackLength = NULL);
+
+    // Where transmitted packets go. Without one they are silently dropped.
+    void setAir(SimAir* air);
+
+    int getRegister(int address);
+    int getStatus();
+
+    // Packets lost because the RX FIFO was full
+    unsigned int overflows;
+
+    // SPI and pin interfaces
+    virtual bool selected();
+    virtual int transfer(int value);
+    virtual void pinChanged(PinName pin, int value);
+
+private:
+    struct payload_t
+    {
+        uint8_t data[SIM_MAX_PAYLOAD];
+        int length;
+        int pipe;
+        bool noAck;
+    };
+
+    struct fifo_t
+    {
+        payload_t entries[SIM_FIFO_DEPTH];
+        int count;
+    };
+
+    void endCommand();
+    void startTransmit();
+    void transmitDone();
+    void ackReceived();
+    int airTime(int length);
+    void updateIrq();
+    int addressWidth();
+    int payloadWidth(int pipe, int length);
+    bool matchPipe(const uint8_t* address, int addressWidth, int* pipe);
+
+    static void push(fifo_t& fifo, const payload_t& p);
+    static void pop(fifo_t& fifo);
+
+    PinName _csn, _ce, _irq, _sck;
+    uint8_t _reg[0x20];
+    uint8_t _rxAddr[2][5];
+    uint8_t _txAddr[5];
+    fifo_t _rx, _tx;
+
+    int _command;
+    int _index;
+    payload_t _buffer;
+    bool _transmitting;
+    int _arcCnt;
+    int _plosCnt;
+    payload_t _ack;
+
+    Timeout _txTimeout;
+    SimAir* _air;
+};
+
+#endif // HAL_POSIX
+
+#endif // _NRF24L01P_SIM_H
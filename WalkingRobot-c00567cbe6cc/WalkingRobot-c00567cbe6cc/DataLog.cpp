@@ -0,0 +1,194 @@
+#include "DataLog.h"
+#include "Gait.h"
+#include "RadioProtocol.h"
+#include <cstring>
+
+
+
+DataLog dataLog;
+
+// The ring fills the second 16 KB SRAM bank on the LPC1768, which is
+// otherwise only used by Ethernet and USB
+#if defined(TARGET_LPC1768)
+static log_block_t ring[LOG_BLOCKS] __attribute__((section("AHBSRAM0")));
+#else
+static log_block_t ring[LOG_BLOCKS];
+#endif
+
+
+
+static int16_t rotationUnits(float value)
+{
+    if (value >= 1.0f) return 32767;
+    if (!(value > -1.0f)) return -32767; // Also catches NaN
+    return (int16_t)(value * LOG_UNIT_ROTATION);
+}
+
+
+
+DataLog::DataLog()
+{
+    records = 0;
+    dropped = 0;
+    written = 0;
+    held = false;
+    head = 0;
+    tail = 0;
+    seq = 0;
+    file = NULL;
+    path[0] = 0;
+    startRequest = false;
+    stopRequest = false;
+    newBlock();
+}
+
+
+
+void DataLog::newBlock()
+{
+    log_block_t& b = ring[head];
+    b.magic = LOG_MAGIC;
+    b.seq = seq++;
+    b.count = 0;
+    b.version = LOG_VERSION;
+}
+
+
+
+void DataLog::tick(uint32_t time, int period, int tick, uint32_t controller, uint8_t frame)
+{
+    log_record_t r;
+
+    if (held) return;
+    r.time = time;
+    r.controller = controller;
+    r.period = period < 0xffff ? period : 0xffff;
+    r.tick = tick < 0xffff ? tick : 0xffff;
+    r.motion[0] = rotationUnits(gaitStatus.motion.c);
+    r.motion[1] = rotationUnits(gaitStatus.motion.s);
+    r.motion[2] = frameUnits(gaitStatus.motion.x);
+    r.motion[3] = frameUnits(gaitStatus.motion.y);
+    r.flags = gaitStatus.moved ? LOG_MOVED : 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        vector3 p = QMat[i]*leg[i]->getFootPosition();
+        r.feet[i][0] = frameUnits(p.x);
+        r.feet[i][1] = frameUnits(p.y);
+        r.feet[i][2] = frameUnits(p.z);
+        r.stability[i] = frameUnits(gaitStatus.stability[i]);
+        if (leg[i]->getStepping()) r.flags |= LOG_STEPPING(i);
+    }
+    r.frame = frame;
+    r.reserved = 0;
+
+    add(r);
+}
+
+
+
+void DataLog::add(const log_record_t& record)
+{
+    // Move on from a full block. While writing to a file, blocks that have
+    // not gone out yet are kept and the new record is dropped; otherwise the
+    // oldest block is overwritten.
+    if (ring[head].count == LOG_RECORDS)
+    {
+        int next = (head + 1) % LOG_BLOCKS;
+        if (next == tail)
+        {
+            if (file)
+            {
+                ++dropped;
+                return;
+            }
+            tail = (tail + 1) % LOG_BLOCKS;
+        }
+        head = next;
+        newBlock();
+    }
+
+    log_block_t& b = ring[head];
+    memcpy(&b.records[b.count], &record, sizeof(record));
+    ++b.count;
+    ++records;
+}
+
+
+
+void DataLog::start(const char* path)
+{
+    strncpy(this->path, path, LOG_PATH_LENGTH - 1);
+    this->path[LOG_PATH_LENGTH - 1] = 0;
+    startRequest = true;
+}
+
+
+
+void DataLog::stop()
+{
+    stopRequest = true;
+}
+
+
+
+void DataLog::service()
+{
+    if (stopRequest)
+    {
+        if (file && tail != head)
+        {
+            // Full blocks one at a time as usual until the ring is drained
+            fwrite(&ring[tail], LOG_BLOCK_SIZE, 1, file);
+            tail = (tail + 1) % LOG_BLOCKS;
+            ++written;
+            return;
+        }
+
+        stopRequest = false;
+        if (!file) return;
+
+        // Then the partial block, and carry on in a new block so nothing
+        // goes out twice
+        if (ring[head].count)
+        {
+            fwrite(&ring[head], LOG_BLOCK_SIZE, 1, file);
+            ++written;
+            head = tail = (head + 1) % LOG_BLOCKS;
+            newBlock();
+        }
+        fclose(file);
+        file = NULL;
+        return;
+    }
+
+    if (startRequest)
+    {
+        startRequest = false;
+        if (file) fclose(file);
+        file = fopen(path, "wb");
+        written = 0;
+        dropped = 0;
+        return;
+    }
+
+    if (file && tail != head)
+    {
+        fwrite(&ring[tail], LOG_BLOCK_SIZE, 1, file);
+        tail = (tail + 1) % LOG_BLOCKS;
+        ++written;
+    }
+}
+
+
+
+int DataLog::blocks()
+{
+    return (head - tail + LOG_BLOCKS) % LOG_BLOCKS + 1;
+}
+
+
+
+const log_block_t& DataLog::block(int i)
+{
+    return ring[(tail + i) % LOG_BLOCKS];
+}
@@ -0,0 +1,106 @@
+#ifndef DATALOG_H
+#define DATALOG_H
+
+#include "HAL.h"
+#include <cstdio>
+
+// Binary log of the control loop, one record per tick. Records are packed
+// into 512 byte blocks, the size of an SD card sector, in a RAM ring. Between
+// ticks service() writes full blocks out to a file one at a time, so the loop
+// never waits on the file system. Without a file the ring keeps the last
+// LOG_BLOCKS blocks, about 1.4 s at 200 Hz.
+//
+// Blocks are written as they are in memory, little endian on both the robot
+// and the host. host/LogDecode turns a log file or a "log dump" into CSV.
+#define LOG_BLOCK_SIZE 512
+#define LOG_RECORDS 9           // Per block
+#define LOG_BLOCKS 32
+#define LOG_MAGIC 0x474c4257    // "WBLG"
+#define LOG_VERSION 1
+#define LOG_PATH_LENGTH 32
+
+// Record flags
+#define LOG_MOVED           0x01
+#define LOG_STEPPING(leg)   (0x10 << (leg))
+
+// Rotations are scaled by this, lengths are in frame units of 0.1 mm
+#define LOG_UNIT_ROTATION 32767.0f
+
+
+
+struct log_record_t
+{
+    uint32_t time;          // Tick start, us on the radio clock
+    uint32_t controller;    // Controller word the tick used
+    uint16_t period;        // us since the last tick started
+    uint16_t tick;          // us the tick took
+    int16_t motion[4];      // Motion transform cos, sin, x, y
+    int16_t feet[4][3];     // Foot positions, robot coordinates
+    int16_t stability[4];
+    uint8_t flags;
+    uint8_t frame;          // Controller frame counter
+    uint16_t reserved;
+};
+
+struct log_block_t
+{
+    uint32_t magic;
+    uint16_t seq;           // Counts blocks, to spot gaps
+    uint8_t count;          // Records used
+    uint8_t version;
+    log_record_t records[LOG_RECORDS];
+};
+
+// Both have to come out the same size with every compiler
+typedef char log_record_size_check[sizeof(log_record_t) == 56 ? 1 : -1];
+typedef char log_block_size_check[sizeof(log_block_t) == LOG_BLOCK_SIZE ? 1 : -1];
+
+
+
+class DataLog
+{
+public:
+    DataLog();
+
+    // Records the tick just run, from gaitStatus and the legs
+    void tick(uint32_t time, int period, int tick, uint32_t controller, uint8_t frame);
+    void add(const log_record_t& record);
+
+    // Opening and closing the file happen in service(), so these are safe
+    // from a terminal command. The file starts with what is still in RAM,
+    // and is closed once the blocks left have gone out one per service().
+    void start(const char* path);
+    void stop();
+    bool writing() { return file != NULL; }
+    bool stopping() { return stopRequest; }
+
+    // Call between ticks. Opens or closes the file when asked to, or writes
+    // out at most one full block. Closing writes the partial block as well.
+    void service();
+
+    // Blocks in RAM, oldest first. The last one is being filled.
+    int blocks();
+    const log_block_t& block(int i);
+
+    uint32_t records;
+    uint32_t dropped;       // Records lost because the file fell behind
+    uint32_t written;       // Blocks written to the file
+
+    // Ticks are not recorded while set, so a dump sees the ring stand still
+    volatile bool held;
+
+private:
+    void newBlock();
+
+    int head;               // Block being filled
+    int tail;               // Oldest block, and the next to write out
+    uint16_t seq;
+    FILE* file;
+    char path[LOG_PATH_LENGTH];
+    volatile bool startRequest;
+    volatile bool stopRequest;
+};
+
+extern DataLog dataLog;
+
+#endif // DATALOG_H
@@ -0,0 +1,82 @@
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <cmath>
+
+// Polynomial approximations of the trig used by the kinematics. The LPC1768
+// has no FPU, so every libm call is a long software float routine.
+//
+// Comment out to go back to the C library for the trig* functions below.
+#define FASTMATH_ENABLED
+
+// Worst case error of any function here, in degrees. A joint angle takes at
+// most two of them, and the finest servo resolution from the calibration in
+// setupLegs is about 0.08 degrees per microsecond of pulse width.
+#define FASTMATH_MAX_ERROR_DEG 0.001f
+
+#define FASTMATH_PI2 1.5707963f
+#define FASTMATH_RAD2DEG 57.2958f
+
+
+
+// atan2 from an 11th order minimax polynomial for atan on [0, 1], max error
+// about 1e-5 radians
+inline float fastAtan2(float y, float x)
+{
+    const float pi = 3.14159265f;
+    const float pi2 = 1.57079633f;
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float mx = ax > ay ? ax : ay;
+    float mn = ax > ay ? ay : ax;
+
+    // Written without branches so loops over it can be vectorized. The
+    // divisor guard makes atan2(0, 0) come out as 0.
+    float z = mn / (mx > 0.0f ? mx : 1.0f);
+    float z2 = z*z;
+    float r = z*(0.99997726f + z2*(-0.33262347f + z2*(0.19354346f + z2*(-0.11643287f + z2*(0.05265332f - z2*0.01172120f)))));
+
+    // Unfold the octant
+    r = ay > ax ? pi2 - r : r;
+    r = x < 0.0f ? pi - r : r;
+    return y < 0.0f ? -r : r;
+}
+
+
+
+// acos from Abramowitz and Stegun 4.4.46, max error about 2e-8 radians plus
+// float rounding. Out of range arguments still give NaN, which the
+// reachability checks in RobotLeg::move rely on.
+inline float fastAcos(float x)
+{
+    const float pi = 3.14159265f;
+    float ax = fabsf(x);
+    float p = 1.5707963050f + ax*(-0.2145988016f + ax*(0.0889789874f + ax*(-0.0501743046f +
+              ax*(0.0308918810f + ax*(-0.0170881256f + ax*(0.0066700901f - ax*0.0012624911f))))));
+    float r = sqrtf(1.0f - ax) * p;
+
+    return x < 0.0f ? pi - r : r;
+}
+
+
+
+// Backend used by the kinematics
+inline float trigAtan2(float y, float x)
+{
+#ifdef FASTMATH_ENABLED
+    return fastAtan2(y, x);
+#else
+    return atan2f(y, x);
+#endif
+}
+
+inline float trigAcos(float x)
+{
+#ifdef FASTMATH_ENABLED
+    return fastAcos(x);
+#else
+    return acosf(x);
+#endif
+}
+
+#endif // FASTMATH_H
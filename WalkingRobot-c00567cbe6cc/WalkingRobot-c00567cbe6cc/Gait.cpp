@@ -0,0 +1,681 @@
+#include "Gait.h"
+#include "Profiler.h"
+#include "utility.h"
+#include <cmath>
+
+
+
+RobotLeg legA(p26, p29, p30, false);
+RobotLeg legB(p13, p14, p15, false);
+RobotLeg legC(p19, p11, p8, false);
+RobotLeg legD(p25, p24, p23, false);
+RobotLeg* leg[4] = { &legA, &legB, &legC, &legD };
+matrix4 QMat[4];
+
+// Movement transform for the last controller input and time step, in robot
+// coordinates and in the coordinates of each leg
+static struct
+{
+    bool valid;
+    float xaxis, yaxis, turnaxis;
+    int steps;
+    rigid2 motion;
+    rigid2 legMotion[4];
+} motionCache;
+GaitStatus gaitStatus;
+SupportPolygon support;
+
+// Measured time steps are rounded to this many seconds, with the remainder
+// carried over, so the transforms above are reused while the loop keeps time
+#define DT_QUANTUM 0.00001f
+
+// Planning runs every planInterval seconds of control ticks. Between plans the
+// step decisions use the last step distances and stability.
+static float planInterval = PLAN_PERIOD;
+static float planElapsed = 0.0f;
+static float dtCarry = 0.0f;
+static int nextStep = 0;
+
+// Lookahead planning. The speed applies from the tick after the plan, the
+// lift only to the tick that made it.
+static step_policy_t currentPolicy = STEP_LOOKAHEAD;
+static StepPlanner planner;
+static float bodySpeed = 1.0f;
+static int liftLeg = -1;
+
+// Body sway over the support of the next leg to lift, and how far it may go
+// this tick
+static bool swayEnabled = true;
+static float swayStep = 0.0f;
+
+// Swing time, the quarter of the swing the diagonal partner lifts at, or -1
+// for none, and the top speed as a multiple of MAXSPEED and MAXTURN
+static const struct
+{
+    const char* name;
+    float stepTime;
+    int partnerPhase;
+    float speed;
+} gaitModes[GAIT_MODES] =
+{
+    { "crawl", 0.4f, -1, 1.0f },
+    { "amble", 0.4f, 2, 2.0f },
+    { "trot", 0.2f, 0, 3.0f }
+};
+static gait_mode_t currentMode = GAIT_CRAWL;
+static const int partner[4] = { 1, 0, 3, 2 };
+
+// Pendulum terms for an overlap starting each quarter of the way through the
+// leader's swing, see pairMargin. They only depend on the mode.
+#define PAIR_PHASES 4
+static float pairCosh[PAIR_PHASES];
+static float pairSinh[PAIR_PHASES];
+
+// Servo calibration for theta, phi and psi of each leg
+const servo_cal_t servoCalibration[4][3] =
+{
+    { { 1130, 2080, 45.0f, -45.0f }, { 1150, 2080, 70.0f, -45.0f }, { 1985, 1055, 70.0f, -60.0f } },
+    { {  990, 1940, 45.0f, -45.0f }, { 1105, 2055, 70.0f, -45.0f }, { 2090, 1150, 70.0f, -60.0f } },
+    { { 1930,  860, 45.0f, -45.0f }, { 1945, 1000, 70.0f, -45.0f }, { 1085, 2005, 70.0f, -60.0f } },
+    { { 2020, 1080, 45.0f, -45.0f }, { 2085, 1145, 70.0f, -45.0f }, { 1070, 2010, 70.0f, -60.0f } }
+};
+
+DigitalOut led1(LED1);
+DigitalOut led2(LED2);
+DigitalOut led3(LED3);
+DigitalOut led4(LED4);
+
+
+
+void setupTransforms()
+{
+    // Initialize matrices to change base from robot coordinates to leg coordinates
+    QMat[0].translate(vector3(0.0508f, 0.0508f, 0.0f));
+    QMat[1].translate(vector3(-0.0508f, -0.0508f, 0.0f));
+    QMat[1].a11 = -1.0f; QMat[1].a22 = -1.0f;
+    QMat[2].translate(vector3(-0.0508f, 0.0508f, 0.0f));
+    QMat[2].a11 = -1.0f;
+    QMat[3].translate(vector3(0.0508f, -0.0508f, 0.0f));
+    QMat[3].a22 = -1.0f;
+    
+    motionCache.valid = false;
+    planElapsed = planInterval;
+    dtCarry = 0.0f;
+    bodySpeed = 1.0f;
+    liftLeg = -1;
+    support.invalidate();
+}
+
+
+
+void setStepPolicy(step_policy_t policy)
+{
+    currentPolicy = policy;
+    bodySpeed = 1.0f;
+    liftLeg = -1;
+}
+
+
+
+step_policy_t stepPolicy()
+{
+    return currentPolicy;
+}
+
+
+
+void setBodySway(bool enabled)
+{
+    swayEnabled = enabled;
+}
+
+
+
+bool bodySway()
+{
+    return swayEnabled;
+}
+
+
+
+void setGaitMode(gait_mode_t mode)
+{
+    // Legs pick up the new swing time as they next lift
+    currentMode = mode;
+    for (int q = 0; q < PAIR_PHASES; ++q)
+    {
+        float wt = PENDULUM_RATE * gaitModes[mode].stepTime * (PAIR_PHASES - q) / PAIR_PHASES;
+        pairCosh[q] = cosh(wt) - 1.0f;
+        pairSinh[q] = sinh(wt)/wt - 1.0f;
+    }
+    motionCache.valid = false;
+    bodySpeed = 1.0f;
+    liftLeg = -1;
+}
+
+
+
+gait_mode_t gaitMode()
+{
+    return currentMode;
+}
+
+
+
+const char* gaitModeName(gait_mode_t mode)
+{
+    return gaitModes[mode].name;
+}
+
+
+
+void setPlanPeriod(float period)
+{
+    planInterval = period;
+}
+
+
+
+float planPeriod()
+{
+    return planInterval;
+}
+
+
+
+bool controlTick(uint32_t controller, float dt)
+{
+    PROFILE_BEGIN(PROFILE_TICK);
+    
+    // Read controller input
+    PROFILE_BEGIN(PROFILE_DECODE);
+    float xaxis = 0.0078125f * deadzone((int8_t)((controller>>0)&0xff), 8); // Convert to +/-1.0f range
+    float yaxis = -0.0078125f * deadzone((int8_t)((controller>>8)&0xff), 8);
+    float turnaxis = -0.0078125f * deadzone((int8_t)((controller>>16)&0xff), 8);
+    PROFILE_END(PROFILE_DECODE);
+    
+    // Reset legs to sane positions when 'A' button is pressed
+    if ((controller>>25)&0x1) resetLegs();
+    
+    // Time step to integrate the motion over, in whole quanta, at the speed
+    // the planner allows
+    if (dt > MAX_DT) dt = MAX_DT;
+    planElapsed += dt;
+    swayStep = SWAY_SPEED*dt;
+    float moveDt = dt*bodySpeed + dtCarry;
+    int steps = (int)(moveDt / DT_QUANTUM + 0.5f);
+    dtCarry = moveDt - steps*DT_QUANTUM;
+    
+    // Compute the movement transforms, unless the input and time step are the
+    // same as last tick
+    PROFILE_BEGIN(PROFILE_TMAT);
+    if (!motionCache.valid || xaxis != motionCache.xaxis || yaxis != motionCache.yaxis || turnaxis != motionCache.turnaxis ||
+        steps != motionCache.steps)
+    {
+        // Compute delta movement vector and delta angle
+        float step = steps*DT_QUANTUM;
+        vector3 v(-xaxis, -yaxis, 0.0f);
+        float scale = gaitModes[currentMode].speed;
+        v = v * MAXSPEED * scale * step;
+        float angle = -turnaxis * MAXTURN * scale * step;
+        
+        // Compute movement transformation in robot coordinates
+        motionCache.motion.identity().rotate(angle).translate(v.x, v.y);
+        
+        // And in leg coordinates
+        PROFILE_BEGIN(PROFILE_LEG_TRANSFORM);
+        for (int i = 0; i < 4; ++i)
+            motionCache.legMotion[i] = motionCache.motion.conjugate(QMat[i]);
+        PROFILE_END(PROFILE_LEG_TRANSFORM);
+        
+        motionCache.xaxis = xaxis;
+        motionCache.yaxis = yaxis;
+        motionCache.turnaxis = turnaxis;
+        motionCache.steps = steps;
+        motionCache.valid = true;
+    }
+    rigid2 TMat = motionCache.motion;
+    PROFILE_END(PROFILE_TMAT);
+    
+    bool plan = planElapsed >= planInterval - 0.5f*DT_QUANTUM;
+    if (plan) planElapsed = planElapsed < 2.0f*planInterval ? planElapsed - planInterval : 0.0f;
+    
+    gaitStatus.planned = plan;
+    gaitStatus.speed = bodySpeed;
+    gaitStatus.moved = processMovement(TMat, motionCache.legMotion, plan);
+    gaitStatus.motion = TMat;
+    
+    PROFILE_END(PROFILE_TICK);
+    
+    return gaitStatus.moved;
+}
+
+
+
+// Velocity of a planted foot relative to the body at the full commanded
+// speed, in robot coordinates and m/s. The body turns about the robot origin.
+static vector3 footVelocity(const vector3& p)
+{
+    float scale = gaitModes[currentMode].speed;
+    float w = -motionCache.turnaxis * MAXTURN * scale;
+    
+    return vector3(-motionCache.xaxis * MAXSPEED * scale - w*p.y, -motionCache.yaxis * MAXSPEED * scale + w*p.x, 0.0f);
+}
+
+
+
+static float footSpeed(int i)
+{
+    vector3 v = footVelocity(QMat[i]*leg[i]->getPosition());
+    
+    return sqrt(v.x*v.x + v.y*v.y);
+}
+
+
+
+// Signed distance of the centre of mass from the line through a and b
+static float lineOffset(const vector3& a, const vector3& b)
+{
+    vector3 o = support.com();
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    
+    return ((a.x - o.x)*dy - (a.y - o.y)*dx) / sqrt(dx*dx + dy*dy);
+}
+
+
+
+// With leg i and its partner in the air the body balances on the line
+// between the other two feet, and tips away from it like an inverted
+// pendulum, faster the further off the line it is. The line moves under the
+// body at the commanded speed, so over the overlap, from the partner lifting
+// in quarter q of leg i's swing to leg i landing, the offset goes from d0 to
+// d1, and the tip at the end is the pendulum's response to that. Returns how
+// much of DYNAMIC_MARGIN it leaves.
+static float pairMargin(int i, int q)
+{
+    float start = gaitModes[currentMode].stepTime * q / PAIR_PHASES;
+    float end = gaitModes[currentMode].stepTime;
+    int k = i < 2 ? 2 : 0;
+    
+    vector3 a = QMat[k]*leg[k]->getPosition();
+    vector3 b = QMat[k + 1]*leg[k + 1]->getPosition();
+    vector3 va = footVelocity(a);
+    vector3 vb = footVelocity(b);
+    float d0 = lineOffset(a + va*start, b + vb*start);
+    float d1 = lineOffset(a + va*end, b + vb*end);
+    float tip = d0*pairCosh[q] + (d1 - d0)*pairSinh[q];
+    
+    return DYNAMIC_MARGIN - fabs(tip);
+}
+
+
+
+// Quarter of leg i's swing its partner can lift in to swing with it, the
+// mode's own if that holds and otherwise the first that does, or -1 if none
+// does or the mode steps one leg at a time. margin gets what is left.
+static int pairPhase(int i, float* margin)
+{
+    int preferred = gaitModes[currentMode].partnerPhase;
+    if (preferred < 0 || leg[partner[i]]->getStepping()) return -1;
+    
+    *margin = pairMargin(i, preferred);
+    if (*margin > 0.0f) return preferred;
+    for (int q = 0; q < PAIR_PHASES; ++q)
+    {
+        if (q == preferred) continue;
+        *margin = pairMargin(i, q);
+        if (*margin > 0.0f) return q;
+    }
+    return -1;
+}
+
+
+
+// Lifts leg i, with its diagonal partner where the mode and the support
+// allow, or alone if its own support margin does. Returns false if neither.
+static bool liftStep(int i)
+{
+    float margin = 0.0f;
+    int q = pairPhase(i, &margin);
+    if (q < 0 && gaitStatus.diagonal[i] <= BORDER_MIN) return false;
+    
+    float stepTime = gaitModes[currentMode].stepTime;
+    leg[i]->setStepTime(stepTime);
+    leg[i]->reset(0.8);
+    
+    if (q >= 0)
+    {
+        int j = partner[i];
+        leg[j]->setStepTime(stepTime);
+        leg[j]->reset(0.8, (float)q / PAIR_PHASES);
+        gaitStatus.pairMargin = margin;
+    }
+    return true;
+}
+
+
+
+// Translation of the planted feet that moves the centre of mass in towards
+// SWAY_MARGIN inside the support leg i leaves when it lifts, at up to
+// SWAY_SPEED. False if the margin is there already.
+static bool swayOver(int i, rigid2& shift)
+{
+    if (i < 0) return false;
+    
+    vector3 n;
+    float need = SWAY_MARGIN - support.liftEdge(i, &n);
+    if (need <= 0.0f) return false;
+    
+    // The feet move the opposite way to the body
+    float d = need < swayStep ? need : swayStep;
+    shift.identity().translate(-n.x*d, -n.y*d);
+    gaitStatus.sway = d;
+    return true;
+}
+
+
+
+// Feet that landed since the last tick, were lifted, or moved outside the
+// gait. A lifted foot counts where it will land, as for the step decisions.
+static void syncSupport()
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        bool stepping = leg[i]->getStepping();
+        if (support.isLifted(i) && !stepping) support.land(i);
+        else if (!support.isLifted(i) && stepping) support.lift(i, QMat[i]*leg[i]->getPosition());
+        
+        if ((support.stale() >> i) & 1) support.setFoot(i, QMat[i]*leg[i]->getPosition());
+    }
+}
+
+
+
+bool processMovement(rigid2& TMat, const rigid2* legMotion, bool plan)
+{
+    // Bring the support polygon up to date with the steps taken last tick
+    syncSupport();
+    gaitStatus.sway = 0.0f;
+    
+    // Check if each leg can perform this motion
+    bool legFree[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        PROFILE_BEGIN(PROFILE_UPDATE);
+        legFree[i] = leg[i]->update(legMotion[i]);
+        PROFILE_END(PROFILE_UPDATE);
+    }
+    
+    // Find the next leg to step, and calculate stability of each leg. Kept
+    // in gaitStatus until the next plan.
+    const float* stability = gaitStatus.diagonal;
+    if (plan)
+    {
+        float stepDist[4];
+        
+        PROFILE_BEGIN(PROFILE_STEP_DISTANCE);
+        RobotLeg::stepDistances(stepDist);
+        PROFILE_END(PROFILE_STEP_DISTANCE);
+        
+        PROFILE_BEGIN(PROFILE_STABILITY);
+        support.liftMargins(gaitStatus.stability);
+        support.diagonalMargins(gaitStatus.diagonal);
+        gaitStatus.margin = support.margin();
+        PROFILE_END(PROFILE_STABILITY);
+        
+        for (int i = 0; i < 4; ++i)
+            gaitStatus.stepDistance[i] = stepDist[i];
+        nextStep = least(stepDist[0], stepDist[1], stepDist[2], stepDist[3]);
+        
+        if (currentPolicy == STEP_LOOKAHEAD)
+        {
+            // Time each planted foot has before it must be off the ground. A
+            // foot at the centre of its circle has no direction to measure in.
+            float edge[4], remaining[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                float d = stepDist[i] == stepDist[i] ? pos(stepDist[i]) : CIRCLE_R;
+                float v = footSpeed(i);
+                edge[i] = v > 0.000001f ? d / v : 1000000.0f;
+                remaining[i] = leg[i]->stepRemaining();
+            }
+            
+            
+            // A leg can also go with its partner in the amble and trot, on
+            // what the pair leaves of the dynamic margin. The time per leg
+            // counts both legs of a pair.
+            float margin[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                float m;
+                margin[i] = gaitStatus.diagonal[i];
+                if (pairPhase(i, &m) >= 0 && BORDER_MAX + m > margin[i]) margin[i] = BORDER_MAX + m;
+            }
+            float stepTime = gaitModes[currentMode].stepTime;
+            int phase = gaitModes[currentMode].partnerPhase;
+            if (phase >= 0) stepTime *= 0.5f + 0.5f*phase/PAIR_PHASES;
+            planner.plan(edge, remaining, margin, stepTime, planInterval);
+            bodySpeed = planner.speed;
+            liftLeg = planner.lift;
+        }
+    }
+    
+    // Check if each leg needs to step, and then check if it's stable before stepping
+    bool stepping = leg[0]->getStepping() || leg[1]->getStepping() || leg[2]->getStepping() || leg[3]->getStepping();
+    const float borderMax = BORDER_MAX; // radius of support base in meters
+    const float borderMin = BORDER_MIN;
+    
+    int blocked = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (!legFree[i])
+        {
+            if (stepping)
+            {
+                TMat.identity();
+                return false;
+            }
+            else 
+            {
+                if (liftStep(i))
+                {
+                    // Stable, alone or in a pair, so stepped
+                    stepping = true;
+                }
+                else if (blocked < 0)
+                {
+                    // Out of its circle but can't lift
+                    blocked = i;
+                }
+            }
+        }
+    }
+    
+    int next = -1;
+    if (currentPolicy == STEP_LOOKAHEAD)
+    {
+        // Lift when the planner says, if nothing else has stepped since
+        if (liftLeg >= 0 && !stepping && liftStep(liftLeg)) stepping = true;
+        liftLeg = -1;
+        if (planner.count) next = planner.order[0];
+    }
+    else
+    {
+        // Check if the next leg to step is stable
+        next = nextStep;
+        if (stability[next] > borderMax)
+        {
+            // Continue to carry out step as normal
+        }
+        else if (stability[next] > borderMin)
+        {
+            if (stepping)
+            {
+                TMat.identity();
+                return false;
+            }
+            else 
+            {
+                liftStep(next);
+                stepping = true;
+            }
+        }
+    }
+    
+    // Sway the body over the support of the next leg to lift. A leg that
+    // can't lift and has run out of circle holds the body where it is, bar
+    // the sway, rather than being dragged on.
+    bool moved = true;
+    rigid2 shift;
+    if (swayEnabled && !stepping && swayOver(blocked >= 0 ? blocked : next, shift))
+    {
+        if (blocked >= 0)
+        {
+            rigid2 still;
+            for (int i = 0; i < 4; ++i)
+                leg[i]->update(still);
+            TMat.identity();
+            moved = false;
+        }
+        for (int i = 0; i < 4; ++i)
+            leg[i]->shift(shift.conjugate(QMat[i]));
+        TMat = shift*TMat;
+    }
+    
+    PROFILE_BEGIN(PROFILE_MOVE);
+    RobotLeg::applyAll();
+    gaitStatus.applyCycles = cycleCount();
+    PROFILE_END(PROFILE_MOVE);
+    support.move(TMat);
+    
+    // Debug info
+    led1 = stability[0] > borderMin;
+    led2 = stability[1] > borderMin;
+    led3 = stability[2] > borderMin;
+    led4 = stability[3] > borderMin;
+    
+    return moved;
+}
+
+
+
+void resetLegs()
+{
+    rigid2 T;
+    legA.reset(-0.6f);
+    while (legA.getStepping())
+    {
+        legA.update(T);
+        legA.apply();
+        wait(PERIOD);
+    }
+    legB.reset(-0.1f);
+    while (legB.getStepping())
+    {
+        legB.update(T);
+        legB.apply();
+        wait(PERIOD);
+    }
+    legC.reset(0.4f);
+    while (legC.getStepping())
+    {
+        legC.update(T);
+        legC.apply();
+        wait(PERIOD);
+    }
+    legD.reset(0.9f);
+    while (legD.getStepping())
+    {
+        legD.update(T);
+        legD.apply();
+        wait(PERIOD);
+    }
+    support.invalidate();
+}
+
+
+
+void setupLegs()
+{
+    // Set leg parameters
+    legA.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
+    legB.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
+    legC.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
+    legD.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
+    legA.setAngleOffsets(OFFSET_THETA, OFFSET_PHI, OFFSET_PSI);
+    legB.setAngleOffsets(OFFSET_THETA, OFFSET_PHI, OFFSET_PSI);
+    legC.setAngleOffsets(OFFSET_THETA, OFFSET_PHI, OFFSET_PSI);
+    legD.setAngleOffsets(OFFSET_THETA, OFFSET_PHI, OFFSET_PSI);
+    legA.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
+    legB.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
+    legC.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
+    legD.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
+    for (int i = 0; i < 4; ++i)
+    {
+        leg[i]->calibrate(servoCalibration[i]);
+        leg[i]->setReachMap(&reachMaps[i]);
+    }
+    
+    // Initialize leg position deltas
+    legA.nDeltaPosition = vector3(0.0f, 0.01f, 0.0f);
+    legB.nDeltaPosition = vector3(0.0f, -0.01f, 0.0f);
+    legC.nDeltaPosition = vector3(0.0f, 0.01f, 0.0f);
+    legD.nDeltaPosition = vector3(0.0f, -0.01f, 0.0f);
+    
+    // Go to initial position
+    legA.move(vector3(0.15f, 0.15f, 0.05f));
+    legB.move(vector3(0.15f, 0.15f, 0.05f));
+    legC.move(vector3(0.15f, 0.15f, 0.05f));
+    legD.move(vector3(0.15f, 0.15f, 0.05f));
+    legA.theta.enable(); wait(0.1f);
+    legB.theta.enable(); wait(0.1f);
+    legC.theta.enable(); wait(0.1f);
+    legD.theta.enable(); wait(0.1f);
+    legA.phi.enable(); wait(0.1f);
+    legB.phi.enable(); wait(0.1f);
+    legC.phi.enable(); wait(0.1f);
+    legD.phi.enable(); wait(0.1f);
+    legA.psi.enable(); wait(0.1f);
+    legB.psi.enable(); wait(0.1f);
+    legC.psi.enable(); wait(0.1f);
+    legD.psi.enable(); wait(0.1f);
+    wait(0.4f);
+    legA.reset(-0.6f);
+    legB.reset(-0.1f);
+    legC.reset(0.4f);
+    legD.reset(0.9f);
+    rigid2 T;
+    while (legA.getStepping())
+    {
+        legA.update(T);
+        legA.apply();
+        legB.update(T);
+        legB.apply();
+        legC.update(T);
+        legC.apply();
+        legD.update(T);
+        legD.apply();
+        wait(PERIOD);
+    }
+}
+
+
+
+float servoResolution()
+{
+    // Finest angle step of any joint for a one microsecond change in pulse width
+    float resolution = 1000.0f;
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            const servo_cal_t& cal = servoCalibration[i][j];
+            float r = (cal.upper - cal.lower) / abs(cal.pulse2 - cal.pulse1);
+            resolution = min(resolution, r);
+        }
+    }
+    
+    return resolution;
+}
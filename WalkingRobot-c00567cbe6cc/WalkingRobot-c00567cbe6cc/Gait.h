@@ -0,0 +1,95 @@
+#ifndef GAIT_H
+#define GAIT_H
+
+#include "HAL.h"
+#include "RobotLeg.h"
+#include "Matrix.h"
+#include "LegGeometry.h"
+#include "StepPlanner.h"
+#include "SupportPolygon.h"
+
+#define MAXSPEED 0.1f
+#define MAXTURN 1.0f
+#define RESET_STEP_TIME 0.4f
+#define CIRCLE_X 0.095f
+#define CIRCLE_Y 0.095f
+#define CIRCLE_Z -0.12f
+#define CIRCLE_R 0.09f
+#define PERIOD 0.005f       // Control period the loop starts with
+#define PLAN_PERIOD 0.005f  // And the planning period, see setPlanPeriod
+#define MAX_DT 0.02f        // Longest step the motion is integrated over
+#define PENDULUM_RATE 9.04f // sqrt(g/h) for the body at -CIRCLE_Z, in 1/s
+#define DYNAMIC_MARGIN 0.02f // Tip off a two foot support line that the swing foot still catches, in m
+#define SWAY_MARGIN 0.011f  // Support margin the body sways to before a leg lifts, in m
+#define SWAY_SPEED 0.1f     // Fastest the body sways, in m/s
+
+
+
+// How the next leg to step is chosen
+enum step_policy_t
+{
+    STEP_GREEDY,            // The leg closest to its edge, freezing the body while one steps
+    STEP_LOOKAHEAD          // StepPlanner
+};
+
+
+
+// Gait modes. The crawl swings one leg at a time. The amble lifts the
+// diagonal partner half way through each swing, and the trot lifts diagonal
+// pairs together with quicker swings, each while the two feet left down can
+// hold the body up for the overlap. Otherwise they step one at a time.
+enum gait_mode_t
+{
+    GAIT_CRAWL,
+    GAIT_AMBLE,
+    GAIT_TROT,
+    GAIT_MODES
+};
+
+
+
+// Result of the last control tick, for logging and simulation
+struct GaitStatus
+{
+    float stepDistance[4];
+    float stability[4]; // Support margin were each leg to lift
+    float diagonal[4]; // Margin across the line between its neighbours, which decides the lifts
+    float margin; // Support margin on the feet down, through any swing
+    rigid2 motion; // Transform applied to the planted feet, identity if stalled and not swaying
+    bool moved; // The commanded motion was applied
+    bool planned; // Step distances and stability were recomputed
+    float speed; // Fraction of the commanded speed the planner allowed
+    float pairMargin; // DYNAMIC_MARGIN less the predicted tip, at the last pair lift
+    float sway; // Body sway this tick, in m
+    uint32_t applyCycles; // cycleCount() at the servo writes, if moved
+};
+
+
+
+extern RobotLeg legA;
+extern RobotLeg legB;
+extern RobotLeg legC;
+extern RobotLeg legD;
+extern RobotLeg* leg[4];
+extern matrix4 QMat[4];
+extern GaitStatus gaitStatus;
+extern SupportPolygon support;
+extern const servo_cal_t servoCalibration[4][3];
+
+void setupLegs();
+void setupTransforms();
+void resetLegs();
+void setStepPolicy(step_policy_t policy);
+step_policy_t stepPolicy();
+void setBodySway(bool enabled);
+bool bodySway();
+void setGaitMode(gait_mode_t mode);
+gait_mode_t gaitMode();
+const char* gaitModeName(gait_mode_t mode);
+void setPlanPeriod(float period);
+float planPeriod();
+bool controlTick(uint32_t controller, float dt = PERIOD);
+bool processMovement(rigid2& TMat, const rigid2* legMotion, bool plan = true);
+float servoResolution();
+
+#endif // GAIT_H
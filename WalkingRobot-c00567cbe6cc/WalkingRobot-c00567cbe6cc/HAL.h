@@ -0,0 +1,34 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Hardware abstraction layer
+//
+// On the mbed target this is just the mbed SDK plus the Servo library. When
+// HAL_POSIX is defined the same class names (Timer, Timeout, Ticker, SPI,
+// DigitalOut, InterruptIn, Serial, Servo) are provided by simulated
+// peripherals running off a virtual clock, so the gait and radio code can be
+// built and profiled on a Linux box. From this directory, with RADIO pointing
+// at the Radio library, every source file but main.cpp goes in:
+//
+//   g++ -O2 -DHAL_POSIX -I. -I$RADIO `ls *.cpp | grep -v main.cpp`
+//       $RADIO/*.cpp <host program>
+
+#ifdef HAL_POSIX
+#include "HAL_posix.h"
+#else
+#include "mbed.h"
+#include "Servo.h"
+
+// Profiling runs off the Cortex-M3 DWT cycle counter
+inline void cycleCounterStart()
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+inline uint32_t cycleCount() { return DWT->CYCCNT; }
+inline uint32_t cycleFrequency() { return SystemCoreClock; }
+#endif
+
+#endif // HAL_H
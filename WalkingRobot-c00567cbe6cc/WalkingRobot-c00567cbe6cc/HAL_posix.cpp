@@ -0,0 +1,329 @@
+#ifdef HAL_POSIX
+
+#include "HAL_posix.h"
+#include <vector>
+#include <algorithm>
+
+
+
+namespace
+{
+    uint64_t simTime = 0;
+    int pinLevel[SIM_PIN_COUNT];
+    uint32_t cycleHz = 0;
+
+    // Peripherals are usually globals, so these are built on first use rather
+    // than relying on static initialization order between files
+    std::vector<SimEvent*>& events()
+    {
+        static std::vector<SimEvent*> v;
+        return v;
+    }
+
+    std::vector<SimPinListener*>& pinListeners(PinName pin)
+    {
+        static std::vector<SimPinListener*> v[SIM_PIN_COUNT];
+        return v[pin];
+    }
+
+    std::vector<SimSPIDevice*>& spiDevices(PinName sclk)
+    {
+        static std::vector<SimSPIDevice*> v[SIM_PIN_COUNT];
+        return v[sclk];
+    }
+
+    unsigned long& spiBytes(PinName sclk)
+    {
+        static unsigned long n[SIM_PIN_COUNT];
+        return n[sclk];
+    }
+
+    bool validPin(PinName pin)
+    {
+        return pin >= 0 && pin < SIM_PIN_COUNT;
+    }
+}
+
+
+
+uint64_t SimClock::now()
+{
+    return simTime;
+}
+
+
+
+void SimClock::advance(uint64_t us)
+{
+    uint64_t target = simTime + us;
+
+    while (true)
+    {
+        // Fire the earliest pending event that falls due before the target.
+        // Events may reschedule themselves or others while firing.
+        std::vector<SimEvent*>& e = events();
+        SimEvent* next = NULL;
+        for (unsigned int i = 0; i < e.size(); ++i)
+        {
+            if (e[i]->pending && e[i]->due <= target && (!next || e[i]->due < next->due))
+                next = e[i];
+        }
+
+        if (!next) break;
+
+        if (next->due > simTime) simTime = next->due;
+        next->fire();
+    }
+
+    simTime = target;
+}
+
+
+
+bool SimClock::advanceToNext()
+{
+    std::vector<SimEvent*>& e = events();
+    SimEvent* next = NULL;
+    for (unsigned int i = 0; i < e.size(); ++i)
+    {
+        if (e[i]->pending && (!next || e[i]->due < next->due))
+            next = e[i];
+    }
+
+    if (!next) return false;
+    advance(next->due > simTime ? next->due - simTime : 0);
+    return true;
+}
+
+
+
+void SimClock::reset()
+{
+    std::vector<SimEvent*>& e = events();
+    simTime = 0;
+    for (unsigned int i = 0; i < e.size(); ++i)
+        e[i]->pending = false;
+}
+
+
+
+void cycleCounterStart()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    // Calibrate the TSC against the monotonic clock
+    timespec a, b;
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    uint32_t c0 = cycleCount();
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &b);
+    } while ((b.tv_sec - a.tv_sec) * 1000000000ll + (b.tv_nsec - a.tv_nsec) < 20000000ll);
+    uint32_t c1 = cycleCount();
+    cycleHz = (uint32_t)((c1 - c0) * (1e9 / ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec))));
+#else
+    cycleHz = 1000000000u;
+#endif
+}
+
+
+
+uint32_t cycleFrequency()
+{
+    if (!cycleHz) cycleCounterStart();
+    return cycleHz;
+}
+
+
+
+SimEvent::SimEvent() : due(0), pending(false)
+{
+    events().push_back(this);
+}
+
+
+
+SimEvent::~SimEvent()
+{
+    std::vector<SimEvent*>& e = events();
+    e.erase(std::remove(e.begin(), e.end(), this), e.end());
+}
+
+
+
+void SimEvent::schedule(uint64_t us)
+{
+    due = simTime + us;
+    pending = true;
+}
+
+
+
+void SimEvent::cancel()
+{
+    pending = false;
+}
+
+
+
+void SimPins::write(PinName pin, int value)
+{
+    if (!validPin(pin)) return;
+
+    value = value ? 1 : 0;
+    if (pinLevel[pin] == value) return;
+    pinLevel[pin] = value;
+
+    std::vector<SimPinListener*>& v = pinListeners(pin);
+    for (unsigned int i = 0; i < v.size(); ++i)
+        v[i]->pinChanged(pin, value);
+}
+
+
+
+int SimPins::read(PinName pin)
+{
+    return validPin(pin) ? pinLevel[pin] : 0;
+}
+
+
+
+void SimPins::listen(PinName pin, SimPinListener* listener)
+{
+    if (validPin(pin)) pinListeners(pin).push_back(listener);
+}
+
+
+
+void SimPins::unlisten(PinName pin, SimPinListener* listener)
+{
+    if (!validPin(pin)) return;
+    std::vector<SimPinListener*>& v = pinListeners(pin);
+    v.erase(std::remove(v.begin(), v.end(), listener), v.end());
+}
+
+
+
+InterruptIn::InterruptIn(PinName pin) : _pin(pin)
+{
+    _level = SimPins::read(pin);
+    SimPins::listen(pin, this);
+}
+
+
+
+InterruptIn::~InterruptIn()
+{
+    SimPins::unlisten(_pin, this);
+}
+
+
+
+void InterruptIn::pinChanged(PinName /*pin*/, int value)
+{
+    int last = _level;
+    _level = value;
+
+    if (!last && value) _rise.call();
+    else if (last && !value) _fall.call();
+}
+
+
+
+void SimSPI::attach(PinName sclk, SimSPIDevice* device)
+{
+    if (validPin(sclk)) spiDevices(sclk).push_back(device);
+}
+
+
+
+void SimSPI::detach(PinName sclk, SimSPIDevice* device)
+{
+    if (!validPin(sclk)) return;
+    std::vector<SimSPIDevice*>& v = spiDevices(sclk);
+    v.erase(std::remove(v.begin(), v.end(), device), v.end());
+}
+
+
+
+unsigned long SimSPI::bytes(PinName sclk)
+{
+    return validPin(sclk) ? spiBytes(sclk) : 0;
+}
+
+
+
+int SPI::write(int value)
+{
+    // MISO floats high when nothing is selected
+    int result = 0xff;
+
+    if (!validPin(_sclk)) return result;
+    ++spiBytes(_sclk);
+
+    std::vector<SimSPIDevice*>& v = spiDevices(_sclk);
+    for (unsigned int i = 0; i < v.size(); ++i)
+    {
+        if (v[i]->selected()) result = v[i]->transfer(value & 0xff);
+    }
+
+    return result;
+}
+
+
+
+Servo::Servo(PinName pin, bool start) : _pin(pin), _enabled(start), _angle(0.0f)
+{
+    calibrate(1000, 2000, 90.0f, -90.0f);
+}
+
+
+
+void Servo::calibrate(int lowerPulse, int upperPulse, float upperLimit, float lowerLimit)
+{
+    _lowerPulse = lowerPulse;
+    _upperPulse = upperPulse;
+    this->upperLimit = upperLimit;
+    this->lowerLimit = lowerLimit;
+}
+
+
+
+void Servo::enable()
+{
+    _enabled = true;
+}
+
+
+
+void Servo::disable()
+{
+    _enabled = false;
+}
+
+
+
+void Servo::write(float degrees)
+{
+    if (degrees > upperLimit) degrees = upperLimit;
+    if (degrees < lowerLimit) degrees = lowerLimit;
+    _angle = degrees;
+}
+
+
+
+float Servo::read()
+{
+    return _angle;
+}
+
+
+
+int Servo::pulse()
+{
+    if (!_enabled) return 0;
+
+    float f = (_angle - lowerLimit) / (upperLimit - lowerLimit);
+    return _lowerPulse + (int)(f * (_upperPulse - _lowerPulse) + 0.5f);
+}
+
+#endif // HAL_POSIX
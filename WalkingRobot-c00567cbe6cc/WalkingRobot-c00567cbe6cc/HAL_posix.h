@@ -0,0 +1,454 @@
+#ifndef HAL_POSIX_H
+#define HAL_POSIX_H
+
+// POSIX backend of the hardware abstraction layer. Provides the subset of the
+// mbed SDK and Servo library used by the robot, backed by a virtual clock and
+// simulated pins. Time only advances through SimClock::advance() and the
+// wait functions, so runs are deterministic and go as fast as the host can.
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+
+enum PinName
+{
+    p5 = 5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
+    p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30,
+    LED1, LED2, LED3, LED4,
+    USBTX, USBRX,
+    NC = -1
+};
+
+#define SIM_PIN_COUNT 256
+
+
+
+// Same layout and semantics as mbed's FunctionPointer
+class FunctionPointer
+{
+public:
+    FunctionPointer(void (*function)() = 0) { attach(function); }
+
+    void attach(void (*function)())
+    {
+        _function = function;
+        _object = 0;
+    }
+
+    template<typename T>
+    void attach(T* object, void (T::*member)())
+    {
+        _object = static_cast<void*>(object);
+        memcpy(_member, (char*)&member, sizeof(member));
+        _membercaller = &FunctionPointer::membercaller<T>;
+        _function = 0;
+    }
+
+    void call()
+    {
+        if (_function) _function();
+        else if (_object) _membercaller(_object, _member);
+    }
+
+private:
+    template<typename T>
+    static void membercaller(void* object, char* member)
+    {
+        T* o = static_cast<T*>(object);
+        void (T::*m)();
+        memcpy((char*)&m, member, sizeof(m));
+        (o->*m)();
+    }
+
+    void (*_function)();
+    void* _object;
+    char _member[16];
+    void (*_membercaller)(void*, char*);
+};
+
+
+
+namespace SimClock
+{
+    // Virtual time in microseconds
+    uint64_t now();
+
+    // Move virtual time forward, firing any timeouts that fall due on the way
+    void advance(uint64_t us);
+
+    // Move to the next thing scheduled and fire it. Returns false if there is
+    // nothing scheduled.
+    bool advanceToNext();
+
+    // Rewind to zero and drop anything still scheduled
+    void reset();
+}
+
+
+
+// Anything scheduled on the virtual clock
+class SimEvent
+{
+public:
+    SimEvent();
+    virtual ~SimEvent();
+
+    uint64_t due;
+    bool pending;
+
+    virtual void fire() = 0;
+
+protected:
+    void schedule(uint64_t us);
+    void cancel();
+};
+
+
+
+class Timer
+{
+public:
+    Timer() : _running(false), _start(0), _elapsed(0) {}
+
+    void start()
+    {
+        if (!_running) _start = SimClock::now();
+        _running = true;
+    }
+
+    void stop()
+    {
+        _elapsed = elapsed();
+        _running = false;
+    }
+
+    void reset()
+    {
+        _start = SimClock::now();
+        _elapsed = 0;
+    }
+
+    float read() { return elapsed() * 0.000001f; }
+    int read_ms() { return (int)(elapsed() / 1000); }
+    int read_us() { return (int)elapsed(); }
+    operator float() { return read(); }
+
+private:
+    uint64_t elapsed() { return _running ? _elapsed + SimClock::now() - _start : _elapsed; }
+
+    bool _running;
+    uint64_t _start;
+    uint64_t _elapsed;
+};
+
+
+
+class Timeout : public SimEvent
+{
+public:
+    void attach(void (*function)(), float t)
+    {
+        _function.attach(function);
+        schedule((uint64_t)(t * 1000000.0f));
+    }
+
+    template<typename T>
+    void attach(T* object, void (T::*member)(), float t)
+    {
+        _function.attach(object, member);
+        schedule((uint64_t)(t * 1000000.0f));
+    }
+
+    void detach() { cancel(); }
+
+    virtual void fire()
+    {
+        cancel();
+        _function.call();
+    }
+
+protected:
+    FunctionPointer _function;
+};
+
+
+
+// Fixed rate like mbed's: each call falls due one interval after the last
+// one was due, however late that one ran
+class Ticker : public SimEvent
+{
+public:
+    Ticker() : _interval(0) {}
+
+    void attach(void (*function)(), float t)
+    {
+        _function.attach(function);
+        start((uint64_t)(t * 1000000.0f));
+    }
+
+    template<typename T>
+    void attach(T* object, void (T::*member)(), float t)
+    {
+        _function.attach(object, member);
+        start((uint64_t)(t * 1000000.0f));
+    }
+
+    void attach_us(void (*function)(), unsigned int us)
+    {
+        _function.attach(function);
+        start(us);
+    }
+
+    template<typename T>
+    void attach_us(T* object, void (T::*member)(), unsigned int us)
+    {
+        _function.attach(object, member);
+        start(us);
+    }
+
+    void detach() { cancel(); }
+
+    virtual void fire()
+    {
+        due += _interval;
+        _function.call();
+    }
+
+private:
+    void start(uint64_t us)
+    {
+        _interval = us > 0 ? us : 1;
+        schedule(_interval);
+    }
+
+    FunctionPointer _function;
+    uint64_t _interval;
+};
+
+
+
+inline void wait_us(int us) { SimClock::advance(us); }
+inline void wait_ms(int ms) { SimClock::advance((uint64_t)ms * 1000); }
+inline void wait(float s) { SimClock::advance((uint64_t)(s * 1000000.0f)); }
+
+// Waits for the next interrupt, which here is the next event on the virtual
+// clock
+inline void sleep() { SimClock::advanceToNext(); }
+
+
+
+// Interrupts are only simulated by calls from the virtual clock, so there is
+// nothing to mask
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+
+// Fatal error like mbed's, which prints the message and halts
+inline void error(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    exit(1);
+}
+
+
+
+// Simulated UART with the 16 byte transmit FIFO of the LPC1768. Characters
+// leave at the baud rate on the virtual clock and putc() waits for room like
+// the real one does. Sent text goes to output if set.
+#define SIM_UART_FIFO 16
+
+class Serial
+{
+public:
+    Serial(PinName /*tx*/, PinName /*rx*/) : output(NULL), sent(0), _baud(9600), _idle(0) {}
+
+    void baud(int rate) { _baud = rate; }
+
+    // Room for another character
+    int writeable() { return _idle <= SimClock::now() + (SIM_UART_FIFO - 1)*charTime(); }
+
+    int putc(int c)
+    {
+        uint64_t now = SimClock::now();
+        uint64_t full = (SIM_UART_FIFO - 1)*charTime();
+        if (_idle > now + full)
+        {
+            SimClock::advance(_idle - now - full);
+            now = SimClock::now();
+        }
+
+        _idle = (_idle > now ? _idle : now) + charTime();
+        if (output) fputc(c, output);
+        ++sent;
+        return c;
+    }
+
+    int puts(const char* s)
+    {
+        while (*s) putc(*s++);
+        return 0;
+    }
+
+    FILE* output;
+    unsigned long sent;
+
+private:
+    // Start, eight data bits and stop
+    uint64_t charTime() { return 10000000 / _baud; }
+
+    int _baud;
+    uint64_t _idle;         // When the FIFO will be empty
+};
+
+
+
+// Cycle counter for profiling. This is the TSC on x86 and a nanosecond clock
+// elsewhere, and is the one thing here that runs on wall time.
+void cycleCounterStart();
+uint32_t cycleFrequency();
+
+inline uint32_t cycleCount()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+#endif
+}
+
+
+
+// Something that wants to see a pin change level (chip selects, IRQ lines)
+class SimPinListener
+{
+public:
+    virtual ~SimPinListener() {}
+    virtual void pinChanged(PinName pin, int value) = 0;
+};
+
+namespace SimPins
+{
+    void write(PinName pin, int value);
+    int read(PinName pin);
+    void listen(PinName pin, SimPinListener* listener);
+    void unlisten(PinName pin, SimPinListener* listener);
+}
+
+
+
+class DigitalOut
+{
+public:
+    DigitalOut(PinName pin, int value = 0) : _pin(pin) { write(value); }
+
+    void write(int value) { SimPins::write(_pin, value); }
+    int read() { return SimPins::read(_pin); }
+    DigitalOut& operator=(int value) { write(value); return *this; }
+    operator int() { return read(); }
+
+private:
+    PinName _pin;
+};
+
+
+
+class InterruptIn : public SimPinListener
+{
+public:
+    InterruptIn(PinName pin);
+    ~InterruptIn();
+
+    int read() { return SimPins::read(_pin); }
+    void rise(void (*function)()) { _rise.attach(function); }
+    void fall(void (*function)()) { _fall.attach(function); }
+
+    template<typename T>
+    void rise(T* object, void (T::*member)()) { _rise.attach(object, member); }
+
+    template<typename T>
+    void fall(T* object, void (T::*member)()) { _fall.attach(object, member); }
+
+    virtual void pinChanged(PinName pin, int value);
+
+private:
+    PinName _pin;
+    int _level;
+    FunctionPointer _rise;
+    FunctionPointer _fall;
+};
+
+
+
+// A simulated chip hanging off an SPI bus. Devices watch their own chip select
+// through SimPins and ignore bytes while deselected.
+class SimSPIDevice
+{
+public:
+    virtual ~SimSPIDevice() {}
+    virtual bool selected() = 0;
+    virtual int transfer(int value) = 0;
+};
+
+namespace SimSPI
+{
+    void attach(PinName sclk, SimSPIDevice* device);
+    void detach(PinName sclk, SimSPIDevice* device);
+
+    // Bytes clocked on a bus so far, for comparing drivers
+    unsigned long bytes(PinName sclk);
+}
+
+class SPI
+{
+public:
+    SPI(PinName /*mosi*/, PinName /*miso*/, PinName sclk) : _sclk(sclk) {}
+
+    void format(int /*bits*/, int /*mode*/ = 0) {}
+    void frequency(int /*hz*/ = 1000000) {}
+    int write(int value);
+
+private:
+    PinName _sclk;
+};
+
+
+
+// Simulated hobby servo with the same interface as the Servo library
+class Servo
+{
+public:
+    Servo(PinName pin, bool start = true);
+
+    // Pulse widths in microseconds at the lower and upper angle limits
+    void calibrate(int lowerPulse, int upperPulse, float upperLimit, float lowerLimit);
+    void enable();
+    void disable();
+    void write(float degrees);
+    float read();
+    int pulse();
+    Servo& operator=(float degrees) { write(degrees); return *this; }
+    operator float() { return read(); }
+
+    float upperLimit, lowerLimit;
+
+private:
+    PinName _pin;
+    bool _enabled;
+    float _angle;
+    int _lowerPulse, _upperPulse;
+};
+
+#endif // HAL_POSIX_H
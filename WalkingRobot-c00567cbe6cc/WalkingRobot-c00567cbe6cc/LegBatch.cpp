@@ -0,0 +1,46 @@
+#include "LegBatch.h"
+#include "utility.h"
+#include <cmath>
+
+
+
+static inline float stepDistanceLane(const LegBatch& k, int i, float dx, float dy)
+{
+    float vx, vy, m, cosval;
+
+    vx = k.px[i] - k.cx[i];
+    vy = k.py[i] - k.cy[i];
+    m = sqrtf(vx*vx + vy*vy);
+    cosval = (dx*vx + dy*vy) / (m * sqrtf(dx*dx + dy*dy));
+
+    return m*cosval + sqrtf(pos(k.cr[i]*k.cr[i] - m*m*(1.0f - cosval*cosval)));
+}
+
+
+
+unsigned int LegBatch::solve()
+{
+    return solve<LaneGeometry>();
+}
+
+
+
+bool LegBatch::solve(int lane)
+{
+    return solve<LaneGeometry>(lane);
+}
+
+
+
+void LegBatch::stepDistance(const float* dx, const float* dy, float* out) const
+{
+    for (int i = 0; i < LEG_COUNT; ++i)
+        out[i] = stepDistanceLane(*this, i, dx[i], dy[i]);
+}
+
+
+
+float LegBatch::stepDistance(int lane, float dx, float dy) const
+{
+    return stepDistanceLane(*this, lane, dx, dy);
+}
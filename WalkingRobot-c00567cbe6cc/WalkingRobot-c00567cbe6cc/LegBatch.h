@@ -0,0 +1,183 @@
+#ifndef LEGBATCH_H
+#define LEGBATCH_H
+
+#include "FastMath.h"
+
+#define LEG_COUNT 4
+
+#if defined(__GNUC__) || defined(__CC_ARM)
+#define LEG_ALIGN __attribute__((aligned(16)))
+#else
+#define LEG_ALIGN
+#endif
+
+
+
+// Kinematic state of all legs in structure-of-arrays form, one lane per leg.
+//
+// The batch functions run the same straight line code over every lane with
+// no early exits, so on the host GCC vectorizes them at -O3 given
+// -fno-math-errno -fno-trapping-math. The Cortex-M3 has no SIMD or FPU and
+// just runs the lanes in turn; a Cortex-M4F port would vectorize the same
+// loops with the DSP extensions. RobotLeg objects are views onto one lane each.
+struct LegBatch
+{
+    // Link lengths and joint angle offsets
+    float a[LEG_COUNT] LEG_ALIGN;
+    float b[LEG_COUNT] LEG_ALIGN;
+    float c[LEG_COUNT] LEG_ALIGN;
+    float d[LEG_COUNT] LEG_ALIGN;
+    float oth[LEG_COUNT] LEG_ALIGN;
+    float oph[LEG_COUNT] LEG_ALIGN;
+    float ops[LEG_COUNT] LEG_ALIGN;
+
+    // Joint limits in degrees
+    float thetaMin[LEG_COUNT] LEG_ALIGN;
+    float thetaMax[LEG_COUNT] LEG_ALIGN;
+    float phiMin[LEG_COUNT] LEG_ALIGN;
+    float phiMax[LEG_COUNT] LEG_ALIGN;
+    float psiMin[LEG_COUNT] LEG_ALIGN;
+    float psiMax[LEG_COUNT] LEG_ALIGN;
+
+    // Step circle in leg coordinates
+    float cx[LEG_COUNT] LEG_ALIGN;
+    float cy[LEG_COUNT] LEG_ALIGN;
+    float cz[LEG_COUNT] LEG_ALIGN;
+    float cr[LEG_COUNT] LEG_ALIGN;
+
+    // Last commanded foot position
+    float px[LEG_COUNT] LEG_ALIGN;
+    float py[LEG_COUNT] LEG_ALIGN;
+    float pz[LEG_COUNT] LEG_ALIGN;
+
+    // IK targets and the resulting joint angles in degrees
+    float tx[LEG_COUNT] LEG_ALIGN;
+    float ty[LEG_COUNT] LEG_ALIGN;
+    float tz[LEG_COUNT] LEG_ALIGN;
+    float theta[LEG_COUNT] LEG_ALIGN;
+    float phi[LEG_COUNT] LEG_ALIGN;
+    float psi[LEG_COUNT] LEG_ALIGN;
+
+    // Inverse kinematics from tx/ty/tz into theta/phi/psi for every lane.
+    // Returns a bit mask of the lanes whose angles are within the limits.
+    unsigned int solve();
+
+    // Same for a single lane
+    bool solve(int lane);
+
+    // Same again with the link lengths and offsets taken from Geometry instead
+    // of the lanes, see FixedGeometry
+    template<class Geometry> unsigned int solve();
+    template<class Geometry> bool solve(int lane);
+
+    // IK of one lane, shared by all of the above
+    template<class Geometry> unsigned int solveLane(int i);
+
+    // Distance from each foot to its step circle edge along the direction of
+    // movement (dx, dy)
+    void stepDistance(const float* dx, const float* dy, float* out) const;
+    float stepDistance(int lane, float dx, float dy) const;
+};
+
+
+
+
+// Invariants of the IK for LegBatch::solveLane. Link lengths are in metres,
+// offsets come out in degrees and the psi offset includes its quarter turn.
+
+// Read from the lanes, as set by RobotLeg::setDimensions and setAngleOffsets
+struct LaneGeometry
+{
+    static float c(const LegBatch& k, int i) { return k.c[i]; }
+    static float d(const LegBatch& k, int i) { return k.d[i]; }
+    static float cc(const LegBatch& k, int i) { return k.c[i]*k.c[i]; }
+    static float aaMinusBb(const LegBatch& k, int i) { return k.a[i]*k.a[i] - k.b[i]*k.b[i]; }
+    static float aaPlusBb(const LegBatch& k, int i) { return k.a[i]*k.a[i] + k.b[i]*k.b[i]; }
+    static float twoA(const LegBatch& k, int i) { return 2.0f*k.a[i]; }
+    static float invTwoAb(const LegBatch& k, int i) { return 1.0f/(2.0f*k.a[i]*k.b[i]); }
+    static float othDeg(const LegBatch& k, int i) { return k.oth[i]*FASTMATH_RAD2DEG; }
+    static float ophDeg(const LegBatch& k, int i) { return k.oph[i]*FASTMATH_RAD2DEG; }
+    static float opsDeg(const LegBatch& k, int i) { return (k.ops[i] + FASTMATH_PI2)*FASTMATH_RAD2DEG; }
+};
+
+
+
+// Fixed at compile time by Dims, a class of static functions a(), b(), c(),
+// d(), oth(), oph() and ops() returning constants (see RobotDimensions). Every
+// invariant folds to a literal, including the divide.
+template<class Dims>
+struct FixedGeometry
+{
+    static float c(const LegBatch&, int) { return Dims::c(); }
+    static float d(const LegBatch&, int) { return Dims::d(); }
+    static float cc(const LegBatch&, int) { return Dims::c()*Dims::c(); }
+    static float aaMinusBb(const LegBatch&, int) { return Dims::a()*Dims::a() - Dims::b()*Dims::b(); }
+    static float aaPlusBb(const LegBatch&, int) { return Dims::a()*Dims::a() + Dims::b()*Dims::b(); }
+    static float twoA(const LegBatch&, int) { return 2.0f*Dims::a(); }
+    static float invTwoAb(const LegBatch&, int) { return 1.0f/(2.0f*Dims::a()*Dims::b()); }
+    static float othDeg(const LegBatch&, int) { return Dims::oth()*FASTMATH_RAD2DEG; }
+    static float ophDeg(const LegBatch&, int) { return Dims::oph()*FASTMATH_RAD2DEG; }
+    static float opsDeg(const LegBatch&, int) { return (Dims::ops() + FASTMATH_PI2)*FASTMATH_RAD2DEG; }
+};
+
+
+
+// Inverse kinematics for one lane, see RobotLeg::move for the geometry. Kept
+// inline and branch free so the loops in solve() can be vectorized.
+template<class Geometry>
+inline unsigned int LegBatch::solveLane(int i)
+{
+    float x = tx[i];
+    float y = ty[i];
+    float z = tz[i];
+    float c = Geometry::c(*this, i);
+    float d = Geometry::d(*this, i);
+    float L, r2, th, ph, ps;
+
+    L = sqrtf(x*x + y*y - Geometry::cc(*this, i)) - d;
+    r2 = L*L + z*z;
+    th = trigAtan2( ((L + d)*y - c*x), ((L + d)*x + c*y) );
+    ph = trigAtan2(z, L) + trigAcos((Geometry::aaMinusBb(*this, i) + r2)/(Geometry::twoA(*this, i)*sqrtf(r2)));
+    ps = trigAcos((Geometry::aaPlusBb(*this, i) - r2)*Geometry::invTwoAb(*this, i));
+
+    // Convert radians to degrees and apply the offsets
+    th = th*FASTMATH_RAD2DEG - Geometry::othDeg(*this, i);
+    ph = ph*FASTMATH_RAD2DEG - Geometry::ophDeg(*this, i);
+    ps = ps*FASTMATH_RAD2DEG - Geometry::opsDeg(*this, i);
+
+    theta[i] = th;
+    phi[i] = ph;
+    psi[i] = ps;
+
+    // Unreachable targets give NaN, which fails every comparison
+    return (th <= thetaMax[i]) & (th >= thetaMin[i]) &
+           (ph <= phiMax[i]) & (ph >= phiMin[i]) &
+           (ps <= psiMax[i]) & (ps >= psiMin[i]);
+}
+
+
+
+template<class Geometry>
+unsigned int LegBatch::solve()
+{
+    unsigned int ok[LEG_COUNT];
+    unsigned int mask = 0;
+
+    for (int i = 0; i < LEG_COUNT; ++i)
+        ok[i] = solveLane<Geometry>(i);
+
+    for (int i = 0; i < LEG_COUNT; ++i)
+        mask |= ok[i] << i;
+
+    return mask;
+}
+
+
+
+template<class Geometry>
+bool LegBatch::solve(int lane)
+{
+    return solveLane<Geometry>(lane) != 0;
+}
+
+#endif // LEGBATCH_H
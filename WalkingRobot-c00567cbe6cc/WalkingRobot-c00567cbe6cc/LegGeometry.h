@@ -0,0 +1,37 @@
+#ifndef LEGGEOMETRY_H
+#define LEGGEOMETRY_H
+
+// Link lengths of every leg in metres
+#define DIM_A 0.125f
+#define DIM_B 0.11f
+#define DIM_C 0.0025f
+#define DIM_D 0.0275f
+
+// Joint angle offsets in radians
+#define OFFSET_THETA 0.7853982f
+#define OFFSET_PHI 0.0f
+#define OFFSET_PSI 0.0f
+
+// Folds the geometry above into the IK of every leg given the same through
+// setDimensions and setAngleOffsets. A leg given anything else, e.g. one
+// with different links, is solved with its own at runtime either way. Comment
+// out to always read the geometry at runtime.
+#define LEG_GEOMETRY_FIXED
+
+
+
+// The geometry above as a class for LegBatch::solve<FixedGeometry<...> >.
+// C++03 has no float template parameters, so the constants go through
+// inline functions, which the compiler folds just the same.
+struct RobotDimensions
+{
+    static float a() { return DIM_A; }
+    static float b() { return DIM_B; }
+    static float c() { return DIM_C; }
+    static float d() { return DIM_D; }
+    static float oth() { return OFFSET_THETA; }
+    static float oph() { return OFFSET_PHI; }
+    static float ops() { return OFFSET_PSI; }
+};
+
+#endif // LEGGEOMETRY_H
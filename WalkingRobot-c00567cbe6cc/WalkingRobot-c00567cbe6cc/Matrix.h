@@ -1,6 +1,26 @@
 #ifndef MATRIX_H
 #define MATRIX_H
 
+#include <cstdio>
+#include <cmath>
+#include <cassert>
+
+// Host builds multiply matrices a row at a time with SIMD. The LPC1768 has no
+// SIMD unit and takes the scalar path, as does defining MATRIX_SCALAR.
+#if defined(__SSE__) && !defined(MATRIX_SCALAR)
+#define MATRIX_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) && !defined(MATRIX_SCALAR)
+#define MATRIX_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__CC_ARM)
+#define MATRIX_ALIGN __attribute__((aligned(16)))
+#else
+#define MATRIX_ALIGN
+#endif
+
 
 
 struct vector3
@@ -19,7 +39,8 @@ struct vector3
 
 
 
-struct matrix4
+// Rows are 16 byte aligned so they load straight into SIMD registers
+struct MATRIX_ALIGN matrix4
 {
     float a11, a12, a13, a14;
     float a21, a22, a23, a24;
@@ -35,7 +56,459 @@ struct matrix4
     matrix4 operator*(const matrix4& other) const;
     vector3 operator*(const vector3& other) const;
     matrix4 inverse() const;
+    
+    // Inverse of a rotation (or reflection) plus translation, by transposing
+    // the rotation. Debug builds assert that the matrix is one.
+    matrix4 inverseRigid() const;
+    bool isRigid(float tolerance) const;
+    
     void print(char* buf, unsigned int len);
 };
 
+
+
+// Rigid motion in the xy plane, z is left alone. Rotation by the angle with
+// cosine c and sine s, followed by translation by (x, y).
+struct rigid2
+{
+    float c, s;
+    float x, y;
+    
+    rigid2();
+    rigid2& identity();
+    rigid2& translate(float dx, float dy);
+    rigid2& rotate(float radians);
+    rigid2 operator*(const rigid2& other) const;
+    vector3 operator*(const vector3& other) const;
+    rigid2 inverse() const;
+    
+    // frame.inverse()*this*frame for a frame whose top left 2x2 block is a
+    // rotation or reflection and which doesn't mix z into x and y, like the
+    // leg frames QMat
+    rigid2 conjugate(const matrix4& frame) const;
+    
+    matrix4 matrix() const;
+};
+
+
+
+
+inline vector3 vector3::operator+(const vector3& v) const
+{
+    vector3 r;
+    r.x = x + v.x;
+    r.y = y + v.y;
+    r.z = z + v.z;
+    return r;
+}
+
+
+
+inline vector3 vector3::operator-(const vector3& v) const
+{
+    vector3 r;
+    r.x = x - v.x;
+    r.y = y - v.y;
+    r.z = z - v.z;
+    return r;
+}
+
+
+
+inline vector3 vector3::operator*(const float f) const
+{
+    vector3 r;
+    r.x = x * f;
+    r.y = y * f;
+    r.z = z * f;
+    return r;
+}
+
+
+
+inline vector3 vector3::operator/(const float f) const
+{
+    vector3 r;
+    r.x = x / f;
+    r.y = y / f;
+    r.z = z / f;
+    return r;
+}
+
+
+
+inline float vector3::norm() const
+{
+    return sqrt(x*x + y*y + z*z);
+}
+
+
+
+inline vector3 vector3::unit() const
+{
+    return (*this)/norm();
+}
+
+
+
+inline void vector3::print(char* buf, unsigned int len)
+{
+    snprintf(buf, len, "%.4f\t%.4f\t%.4f", x, y, z);
+}
+
+
+
+inline matrix4::matrix4()
+{
+    // Initialize as identity matrix
+    identity();
+}
+
+
+
+inline matrix4& matrix4::identity()
+{
+    a11 = 1.0f; a12 = 0.0f; a13 = 0.0f; a14 = 0.0f;
+    a21 = 0.0f; a22 = 1.0f; a23 = 0.0f; a24 = 0.0f;
+    a31 = 0.0f; a32 = 0.0f; a33 = 1.0f; a34 = 0.0f;
+    return *this;
+}
+
+
+
+inline matrix4& matrix4::translate(const vector3 v)
+{
+    a14 += v.x;
+    a24 += v.y;
+    a34 += v.z;
+    return *this;
+}
+
+
+
+inline matrix4& matrix4::rotateX(float radians)
+{
+    float b21 = a21;
+    float b22 = a22;
+    float b23 = a23;
+    float b24 = a24;
+    float sinx = sin(radians);
+    float cosx = cos(radians);
+    
+    a21 = a21*cosx - a31*sinx;
+    a22 = a22*cosx - a32*sinx;
+    a23 = a23*cosx - a33*sinx;
+    a24 = a24*cosx - a34*sinx;
+    
+    a31 = a31*cosx + b21*sinx;
+    a32 = a32*cosx + b22*sinx;
+    a33 = a33*cosx + b23*sinx;
+    a34 = a34*cosx + b24*sinx;
+    
+    return *this;
+}
+
+
+
+inline matrix4& matrix4::rotateY(float radians)
+{
+    float b31 = a31;
+    float b32 = a32;
+    float b33 = a33;
+    float b34 = a34;
+    float sinx = sin(radians);
+    float cosx = cos(radians);
+    
+    a31 = a31*cosx - a11*sinx;
+    a32 = a32*cosx - a12*sinx;
+    a33 = a33*cosx - a13*sinx;
+    a34 = a34*cosx - a14*sinx;
+    
+    a11 = a11*cosx + b31*sinx;
+    a12 = a12*cosx + b32*sinx;
+    a13 = a13*cosx + b33*sinx;
+    a14 = a14*cosx + b34*sinx;
+    
+    return *this;
+}
+
+
+
+inline matrix4& matrix4::rotateZ(float radians)
+{
+    float b11 = a11;
+    float b12 = a12;
+    float b13 = a13;
+    float b14 = a14;
+    float sinx = sin(radians);
+    float cosx = cos(radians);
+    
+    a11 = a11*cosx - a21*sinx;
+    a12 = a12*cosx - a22*sinx;
+    a13 = a13*cosx - a23*sinx;
+    a14 = a14*cosx - a24*sinx;
+    
+    a21 = a21*cosx + b11*sinx;
+    a22 = a22*cosx + b12*sinx;
+    a23 = a23*cosx + b13*sinx;
+    a24 = a24*cosx + b14*sinx;
+    
+    return *this;
+}
+
+
+
+inline matrix4 matrix4::operator*(const matrix4& other) const
+{
+    matrix4 result;
+    
+#if defined(MATRIX_SSE) || defined(MATRIX_NEON)
+    // Each result row is a sum of the rows of other, scaled by one row of
+    // this, in the same order as the scalar code below
+    const float* a = &a11;
+    const float* b = &other.a11;
+    float* r = &result.a11;
+    
+    for (int i = 0; i < 3; ++i, a += 4, r += 4)
+    {
+#ifdef MATRIX_SSE
+        __m128 row = _mm_mul_ps(_mm_set1_ps(a[0]), _mm_load_ps(b));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[1]), _mm_load_ps(b + 4)));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[2]), _mm_load_ps(b + 8)));
+        row = _mm_add_ps(row, _mm_set_ps(a[3], 0.0f, 0.0f, 0.0f));
+        _mm_store_ps(r, row);
+#else
+        float32x4_t row = vmulq_n_f32(vld1q_f32(b), a[0]);
+        row = vaddq_f32(row, vmulq_n_f32(vld1q_f32(b + 4), a[1]));
+        row = vaddq_f32(row, vmulq_n_f32(vld1q_f32(b + 8), a[2]));
+        row = vsetq_lane_f32(vgetq_lane_f32(row, 3) + a[3], row, 3);
+        vst1q_f32(r, row);
+#endif
+    }
+#else
+    result.a11 = a11*other.a11 + a12*other.a21 + a13*other.a31;
+    result.a12 = a11*other.a12 + a12*other.a22 + a13*other.a32;
+    result.a13 = a11*other.a13 + a12*other.a23 + a13*other.a33;
+    result.a14 = a11*other.a14 + a12*other.a24 + a13*other.a34 + a14;
+    
+    result.a21 = a21*other.a11 + a22*other.a21 + a23*other.a31;
+    result.a22 = a21*other.a12 + a22*other.a22 + a23*other.a32;
+    result.a23 = a21*other.a13 + a22*other.a23 + a23*other.a33;
+    result.a24 = a21*other.a14 + a22*other.a24 + a23*other.a34 + a24;
+    
+    result.a31 = a31*other.a11 + a32*other.a21 + a33*other.a31;
+    result.a32 = a31*other.a12 + a32*other.a22 + a33*other.a32;
+    result.a33 = a31*other.a13 + a32*other.a23 + a33*other.a33;
+    result.a34 = a31*other.a14 + a32*other.a24 + a33*other.a34 + a34;
+#endif
+    
+    return result;
+}
+
+
+
+inline vector3 matrix4::operator*(const vector3& other) const
+{
+    vector3 result;
+    
+    result.x = a11*other.x + a12*other.y + a13*other.z + a14;
+    result.y = a21*other.x + a22*other.y + a23*other.z + a24;
+    result.z = a31*other.x + a32*other.y + a33*other.z + a34;
+    
+    return result;
+}
+
+
+
+inline matrix4 matrix4::inverse() const
+{
+    matrix4 result;
+    float idet = 1.0f/(a11*a22*a33 - a11*a23*a32 - a12*a21*a33 + a12*a23*a31 + a13*a21*a32 - a13*a22*a31);
+    
+    result.a11 = (a22*a33 - a23*a32)*idet;
+    result.a12 = (a13*a32 - a12*a33)*idet;
+    result.a13 = (a12*a23 - a13*a22)*idet;
+    result.a14 = (a12*a24*a33 - a12*a23*a34 + a13*a22*a34 - a13*a24*a32 - a14*a22*a33 + a14*a23*a32)*idet;
+    
+    result.a21 = (a23*a31 - a21*a33)*idet;
+    result.a22 = (a11*a33 - a13*a31)*idet;
+    result.a23 = (a13*a21 - a11*a23)*idet;
+    result.a24 = (a11*a23*a34 - a11*a24*a33 - a13*a21*a34 + a13*a24*a31 + a14*a21*a33 - a14*a23*a31)*idet;
+    
+    result.a31 = (a21*a32 - a22*a31)*idet;
+    result.a32 = (a12*a31 - a11*a32)*idet;
+    result.a33 = (a11*a22 - a12*a21)*idet;
+    result.a34 = (a11*a24*a32 - a11*a22*a34 + a12*a21*a34 - a12*a24*a31 - a14*a21*a32 + a14*a22*a31)*idet;
+
+    return result;
+}
+
+
+
+inline matrix4 matrix4::inverseRigid() const
+{
+    matrix4 result;
+    
+    assert(isRigid(0.0001f));
+    
+    result.a11 = a11; result.a12 = a21; result.a13 = a31;
+    result.a21 = a12; result.a22 = a22; result.a23 = a32;
+    result.a31 = a13; result.a32 = a23; result.a33 = a33;
+    
+    result.a14 = -(a11*a14 + a21*a24 + a31*a34);
+    result.a24 = -(a12*a14 + a22*a24 + a32*a34);
+    result.a34 = -(a13*a14 + a23*a24 + a33*a34);
+    
+    return result;
+}
+
+
+
+inline bool matrix4::isRigid(float tolerance) const
+{
+    // Columns of unit length and at right angles to each other
+    float e[6];
+    e[0] = a11*a11 + a21*a21 + a31*a31 - 1.0f;
+    e[1] = a12*a12 + a22*a22 + a32*a32 - 1.0f;
+    e[2] = a13*a13 + a23*a23 + a33*a33 - 1.0f;
+    e[3] = a11*a12 + a21*a22 + a31*a32;
+    e[4] = a11*a13 + a21*a23 + a31*a33;
+    e[5] = a12*a13 + a22*a23 + a32*a33;
+    
+    for (int i = 0; i < 6; ++i)
+        if (fabs(e[i]) > tolerance) return false;
+    
+    return true;
+}
+
+
+
+inline void matrix4::print(char* buf, unsigned int len)
+{
+    snprintf(buf, len, "%.4f\t%.4f\t%.4f\t%.4f\n"
+                          "%.4f\t%.4f\t%.4f\t%.4f\n"
+                          "%.4f\t%.4f\t%.4f\t%.4f\n"
+                          "0     \t0     \t0     \t1\n",
+            a11, a12, a13, a14,
+            a21, a22, a23, a24,
+            a31, a32, a33, a34);
+}
+
+
+
+inline rigid2::rigid2()
+{
+    identity();
+}
+
+
+
+inline rigid2& rigid2::identity()
+{
+    c = 1.0f; s = 0.0f;
+    x = 0.0f; y = 0.0f;
+    return *this;
+}
+
+
+
+inline rigid2& rigid2::translate(float dx, float dy)
+{
+    x += dx;
+    y += dy;
+    return *this;
+}
+
+
+
+inline rigid2& rigid2::rotate(float radians)
+{
+    // Same as matrix4::rotateZ, the rotation is applied after this one
+    float sinx = sin(radians);
+    float cosx = cos(radians);
+    float b = c;
+    float bx = x;
+    
+    c = c*cosx - s*sinx;
+    s = s*cosx + b*sinx;
+    x = x*cosx - y*sinx;
+    y = y*cosx + bx*sinx;
+    
+    return *this;
+}
+
+
+
+inline rigid2 rigid2::operator*(const rigid2& other) const
+{
+    rigid2 result;
+    
+    result.c = c*other.c - s*other.s;
+    result.s = s*other.c + c*other.s;
+    result.x = c*other.x - s*other.y + x;
+    result.y = s*other.x + c*other.y + y;
+    
+    return result;
+}
+
+
+
+inline vector3 rigid2::operator*(const vector3& other) const
+{
+    vector3 result;
+    
+    result.x = c*other.x - s*other.y + x;
+    result.y = s*other.x + c*other.y + y;
+    result.z = other.z;
+    
+    return result;
+}
+
+
+
+inline rigid2 rigid2::inverse() const
+{
+    rigid2 result;
+    
+    // Transpose the rotation and rotate the translation back
+    result.c = c;
+    result.s = -s;
+    result.x = -(c*x + s*y);
+    result.y = s*x - c*y;
+    
+    return result;
+}
+
+
+
+inline rigid2 rigid2::conjugate(const matrix4& frame) const
+{
+    rigid2 result;
+    
+    // With frame = [A | q], the result is [A'RA | A'(Rq + t - q)]. A'RA is R
+    // for a rotation and R transposed for a reflection.
+    float det = frame.a11*frame.a22 - frame.a12*frame.a21;
+    float wx = c*frame.a14 - s*frame.a24 + x - frame.a14;
+    float wy = s*frame.a14 + c*frame.a24 + y - frame.a24;
+    
+    result.c = c;
+    result.s = s*det;
+    result.x = frame.a11*wx + frame.a21*wy;
+    result.y = frame.a12*wx + frame.a22*wy;
+    
+    return result;
+}
+
+
+
+inline matrix4 rigid2::matrix() const
+{
+    matrix4 result;
+    
+    result.a11 = c; result.a12 = -s; result.a14 = x;
+    result.a21 = s; result.a22 = c;  result.a24 = y;
+    
+    return result;
+}
+
 #endif // MATRIX_H
\ No newline at end of file
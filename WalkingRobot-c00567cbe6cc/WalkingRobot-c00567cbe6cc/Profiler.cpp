@@ -0,0 +1,234 @@
+#include "Profiler.h"
+#include "TextOut.h"
+
+
+
+Profiler profiler;
+LatencyTrace latencyTrace;
+
+
+
+static inline int log2i(uint32_t v)
+{
+#if defined(__CC_ARM)
+    return 31 - __clz(v);
+#elif defined(__GNUC__)
+    return 31 - __builtin_clz(v);
+#else
+    int r = 0;
+    while (v >>= 1) ++r;
+    return r;
+#endif
+}
+
+
+
+void StageHistogram::clear()
+{
+    count = 0;
+    min = 0xffffffff;
+    max = 0;
+    for (int i = 0; i < PROFILE_BINS; ++i)
+        bins[i] = 0;
+}
+
+
+
+void StageHistogram::add(uint32_t cycles)
+{
+    int bin;
+
+    if (cycles < PROFILE_SUBBINS)
+    {
+        bin = cycles;
+    }
+    else
+    {
+        // Octave from the leading one, sub-bin from the next two bits
+        int o = log2i(cycles);
+        bin = (o - 1)*PROFILE_SUBBINS + ((cycles >> (o - 2)) & (PROFILE_SUBBINS - 1));
+        if (bin >= PROFILE_BINS) bin = PROFILE_BINS - 1;
+    }
+
+    ++bins[bin];
+    ++count;
+    if (cycles < min) min = cycles;
+    if (cycles > max) max = cycles;
+}
+
+
+
+uint32_t StageHistogram::percentile(float p) const
+{
+    if (!count) return 0;
+
+    uint32_t rank = (uint32_t)(p * count);
+    if (rank >= count) rank = count - 1;
+
+    uint32_t seen = 0;
+    int bin = 0;
+    for (; bin < PROFILE_BINS; ++bin)
+    {
+        seen += bins[bin];
+        if (seen > rank) break;
+    }
+
+    // Report the middle of the bin, kept inside the exact range
+    uint32_t value;
+    if (bin < PROFILE_SUBBINS)
+    {
+        value = bin;
+    }
+    else
+    {
+        int o = bin/PROFILE_SUBBINS + 1;
+        int sub = bin%PROFILE_SUBBINS;
+        uint32_t width = 1u << (o - 2);
+        value = (PROFILE_SUBBINS + sub)*width + width/2;
+    }
+
+    if (value < min) value = min;
+    if (value > max) value = max;
+    return value;
+}
+
+
+
+Profiler::Profiler()
+{
+    reset();
+}
+
+
+
+void Profiler::reset()
+{
+    for (int i = 0; i < PROFILE_STAGES; ++i)
+        stages[i].clear();
+}
+
+
+
+int Profiler::print(char* buf, int len, profile_stage_t stage) const
+{
+    const StageHistogram& h = stages[stage];
+
+    TextLine line(buf, len);
+
+    line.text(name(stage), 14).put(' ').number((unsigned long)h.count, 8).put(' ');
+    line.number((unsigned long)(h.count ? h.min : 0), 8).put(' ');
+    line.number((unsigned long)h.percentile(0.5f), 8).put(' ');
+    line.number((unsigned long)h.percentile(0.99f), 8).put(' ');
+    line.number((unsigned long)h.max, 8).put('\n');
+    return line.length();
+}
+
+
+
+float Profiler::budget(float period, bool worst) const
+{
+    const StageHistogram& h = stages[PROFILE_TICK];
+    uint32_t cycles = worst ? h.max : h.percentile(0.99f);
+
+    return cycles / (period * cycleFrequency());
+}
+
+
+
+const char* Profiler::name(profile_stage_t stage)
+{
+    static const char* names[PROFILE_STAGES] =
+    {
+        "decode",
+        "tmat",
+        "leg_transform",
+        "update",
+        "step_distance",
+        "stability",
+        "move",
+        "tick",
+        "command"
+    };
+
+    return names[stage];
+}
+
+
+
+LatencyTrace::LatencyTrace()
+{
+    reset();
+    received = 0;
+}
+
+
+
+void LatencyTrace::reset()
+{
+    for (int i = 0; i < LATENCY_STAGES; ++i)
+        stages[i].clear();
+    haveLast = false;
+    pending = false;
+}
+
+
+
+void LatencyTrace::tickStart(uint8_t frame, uint32_t received, uint32_t now)
+{
+    // A new frame has a new arrival time
+    if (received != this->received)
+    {
+        this->frame = frame;
+        this->received = received;
+        pending = true;
+        stages[LATENCY_QUEUE].add(now - received);
+    }
+
+    tickTime = now;
+    tickCycles = cycleCount();
+}
+
+
+
+void LatencyTrace::applied(uint32_t cycles)
+{
+    if (!pending) return;
+    pending = false;
+
+    uint32_t tick = (uint32_t)((uint64_t)(cycles - tickCycles) * 1000000 / cycleFrequency());
+    stages[LATENCY_TICK].add(tick);
+    lastLatency = tickTime - received + tick;
+    stages[LATENCY_ROBOT].add(lastLatency);
+    lastFrame = frame;
+    haveLast = true;
+}
+
+
+
+int LatencyTrace::print(char* buf, int len, latency_stage_t stage) const
+{
+    const StageHistogram& h = stages[stage];
+
+    TextLine line(buf, len);
+
+    line.text(name(stage), 14).put(' ').number((unsigned long)h.count, 8).put(' ');
+    line.number((unsigned long)(h.count ? h.min : 0), 8).put(' ');
+    line.number((unsigned long)h.percentile(0.5f), 8).put(' ');
+    line.number((unsigned long)h.percentile(0.99f), 8).put(' ');
+    line.number((unsigned long)h.max, 8).put('\n');
+    return line.length();
+}
+
+
+
+const char* LatencyTrace::name(latency_stage_t stage)
+{
+    static const char* names[LATENCY_STAGES] =
+    {
+        "queue",
+        "tick",
+        "robot"
+    };
+
+    return names[stage];
+}
@@ -0,0 +1,127 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "HAL.h"
+
+// Comment out to compile the stage timing out of the control loop
+#define PROFILE_ENABLED
+
+// Log-linear histogram: each power of two is split into PROFILE_SUBBINS bins,
+// so percentiles are good to within about 20% while min and max are exact
+#define PROFILE_OCTAVES 28
+#define PROFILE_SUBBINS 4
+#define PROFILE_BINS (PROFILE_OCTAVES*PROFILE_SUBBINS)
+
+
+
+enum profile_stage_t
+{
+    PROFILE_DECODE,         // Controller word to axes
+    PROFILE_TMAT,           // Movement transforms, cached between ticks
+    PROFILE_LEG_TRANSFORM,  // Movement in leg coordinates, when recomputed
+    PROFILE_UPDATE,         // RobotLeg::update, per leg
+    PROFILE_STEP_DISTANCE,  // Step distance of all legs
+    PROFILE_STABILITY,      // Support margins of all legs
+    PROFILE_MOVE,           // Batched IK and servo writes
+    PROFILE_TICK,           // Whole control tick
+    PROFILE_COMMAND,        // Terminal command, output queued
+    PROFILE_STAGES
+};
+
+
+
+// Where the time goes between a controller frame arriving and the servos
+// moving, in microseconds
+enum latency_stage_t
+{
+    LATENCY_QUEUE,          // Radio IRQ to the start of the tick that uses the frame
+    LATENCY_TICK,           // Tick start to the servo writes
+    LATENCY_ROBOT,          // Radio IRQ to the servo writes, stalled ticks included
+    LATENCY_STAGES
+};
+
+
+
+struct StageHistogram
+{
+    uint32_t count;
+    uint32_t min, max;
+    uint32_t bins[PROFILE_BINS];
+
+    void clear();
+    void add(uint32_t cycles);
+    uint32_t percentile(float p) const;
+};
+
+
+
+class Profiler
+{
+public:
+    Profiler();
+    void reset();
+    void record(profile_stage_t stage, uint32_t cycles) { stages[stage].add(cycles); }
+
+    // One line per stage with min/p50/p99/max in cycles. Returns the number
+    // of characters written. Formatted without printf, so it is cheap enough
+    // to call between ticks.
+    int print(char* buf, int len, profile_stage_t stage) const;
+
+    // Fraction of a control period the p99 and worst case tick take
+    float budget(float period, bool worst) const;
+
+    static const char* name(profile_stage_t stage);
+
+    StageHistogram stages[PROFILE_STAGES];
+};
+
+extern Profiler profiler;
+
+
+
+// Follows each controller frame from the radio to the servos. Arrival and
+// tick start are on the radio's clock; the tick itself is timed in cycles.
+class LatencyTrace
+{
+public:
+    LatencyTrace();
+    void reset();
+
+    // At the start of every tick, with the frame counter and arrival time of
+    // the controller frame it uses, and the radio clock
+    void tickStart(uint8_t frame, uint32_t received, uint32_t now);
+
+    // After a tick that wrote the servos, with cycleCount() at the writes
+    void applied(uint32_t cycles);
+
+    // Same layout as Profiler::print, in microseconds
+    int print(char* buf, int len, latency_stage_t stage) const;
+
+    static const char* name(latency_stage_t stage);
+
+    StageHistogram stages[LATENCY_STAGES];
+
+    // Latest frame to reach the servos, for telemetry
+    bool haveLast;
+    uint8_t lastFrame;
+    uint32_t lastLatency;
+
+private:
+    bool pending;           // Waiting for its first servo write
+    uint8_t frame;
+    uint32_t received;
+    uint32_t tickTime;
+    uint32_t tickCycles;
+};
+
+extern LatencyTrace latencyTrace;
+
+#ifdef PROFILE_ENABLED
+#define PROFILE_BEGIN(stage) uint32_t profile_##stage = cycleCount()
+#define PROFILE_END(stage) profiler.record(stage, cycleCount() - profile_##stage)
+#else
+#define PROFILE_BEGIN(stage)
+#define PROFILE_END(stage)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,25 @@
+#include "ReachMap.h"
+#include "LegBatch.h"
+#include <cmath>
+
+
+
+bool ReachMap::matches(const LegBatch& k, int lane) const
+{
+    const float eps = 0.000001f;
+    float current[13] =
+    {
+        k.thetaMin[lane], k.thetaMax[lane], k.phiMin[lane], k.phiMax[lane], k.psiMin[lane], k.psiMax[lane],
+        k.a[lane], k.b[lane], k.c[lane], k.d[lane],
+        k.oth[lane], k.oph[lane], k.ops[lane]
+    };
+    
+    for (int i = 0; i < 6; ++i)
+        if (fabs(current[i] - limits[i]) > eps) return false;
+    for (int i = 0; i < 4; ++i)
+        if (fabs(current[6 + i] - dims[i]) > eps) return false;
+    for (int i = 0; i < 3; ++i)
+        if (fabs(current[10 + i] - offsets[i]) > eps) return false;
+    
+    return true;
+}
@@ -0,0 +1,57 @@
+#ifndef REACHMAP_H
+#define REACHMAP_H
+
+#include "HAL.h"
+#include "Matrix.h"
+
+struct LegBatch;
+
+// Cell classes, two bits each
+#define REACH_OUT 0     // No point in the cell is reachable
+#define REACH_IN 1      // Every point in the cell is reachable
+#define REACH_EDGE 2    // The cell crosses a joint limit, solve the IK to know
+
+
+
+// Reachability of a leg's workspace on a regular grid in leg coordinates,
+// generated offline by host/ReachMapGen.cpp from the servo calibration and
+// leg geometry. Anything outside the grid is out of reach.
+struct ReachMap
+{
+    float x0, y0, z0;       // Corner of the grid
+    float invCell;          // Cells per metre
+    int nx, ny, nz;
+    const uint8_t* cells;   // Four cells per byte, lowest bits first, x fastest
+
+    // Joint limits, link lengths and angle offsets the map was generated for
+    float limits[6];        // thetaMin, thetaMax, phiMin, phiMax, psiMin, psiMax
+    float dims[4];          // a, b, c, d
+    float offsets[3];       // oth, oph, ops
+
+    int query(float x, float y, float z) const
+    {
+        // Truncation rounds towards zero, so take the sign test on the float
+        float fx = (x - x0)*invCell;
+        float fy = (y - y0)*invCell;
+        float fz = (z - z0)*invCell;
+        if (fx < 0.0f || fy < 0.0f || fz < 0.0f) return REACH_OUT;
+
+        int ix = (int)fx;
+        int iy = (int)fy;
+        int iz = (int)fz;
+        if (ix >= nx || iy >= ny || iz >= nz) return REACH_OUT;
+
+        int i = (iz*ny + iy)*nx + ix;
+        return (cells[i >> 2] >> ((i & 3)*2)) & 3;
+    }
+
+    int query(const vector3& p) const { return query(p.x, p.y, p.z); }
+
+    // True if the map was generated for the limits, geometry and offsets of a lane
+    bool matches(const LegBatch& k, int lane) const;
+};
+
+// Generated, one per leg in the order of leg[] in Gait.cpp
+extern const ReachMap reachMaps[4];
+
+#endif // REACHMAP_H
@@ -0,0 +1,579 @@
+// Generated by host/ReachMapGen.cpp, do not edit. Regenerate whenever the
+// servo calibration in Gait.cpp or the geometry in LegGeometry.h changes.
+// Cell size 0.01 m, 5 samples per cell edge.
+
+#include "ReachMap.h"
+
+
+
+static const uint8_t cellsA[8729] =
+{
+    0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0xaa,
+    0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa,
+    0x02, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00,
+    0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x80,
+    0xaa, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa,
+    0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa,
+    0x02, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x2a, 0x00,
+    0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xa8,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x80, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x2a, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0x02,
+    0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00,
+    0xa0, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa,
+    0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0xa8, 0xaa,
+    0xaa, 0xaa, 0x2a, 0x00, 0x00, 0xa8, 0xaa, 0x55, 0x95, 0xaa, 0x00, 0x00, 0xa8, 0xaa, 0x56, 0x55,
+    0xaa, 0x02, 0x00, 0xaa, 0xaa, 0x56, 0x55, 0xa9, 0x0a, 0x00, 0xa8, 0xaa, 0x5a, 0x55, 0xa9, 0x2a,
+    0x00, 0xa0, 0xaa, 0x5a, 0x55, 0xa5, 0xaa, 0x00, 0x80, 0xaa, 0x5a, 0x55, 0x95, 0xaa, 0x00, 0x00,
+    0xaa, 0x56, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0x95, 0xaa, 0x0a, 0x00, 0xa0, 0x55,
+    0x55, 0x55, 0xaa, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xaa, 0x2a, 0x00, 0x00, 0x5a, 0x55, 0x55,
+    0xaa, 0x2a, 0x00, 0x00, 0x68, 0x55, 0x95, 0xaa, 0x2a, 0x00, 0x00, 0xa0, 0x55, 0x95, 0xaa, 0xaa,
+    0x00, 0x00, 0x80, 0x56, 0xa9, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0xa8, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80,
+    0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00,
+    0xaa, 0x5a, 0x55, 0x55, 0xa9, 0x02, 0x80, 0xaa, 0x6a, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0xaa, 0x6a,
+    0x55, 0x55, 0xa5, 0x2a, 0x00, 0xa8, 0x6a, 0x55, 0x55, 0x95, 0xaa, 0x00, 0xa0, 0x6a, 0x55, 0x55,
+    0x55, 0xaa, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa9,
+    0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa9, 0x2a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00,
+    0x80, 0x56, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x68,
+    0x55, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0xa0, 0x55, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x80, 0x56, 0x55,
+    0xa9, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x68, 0xa5, 0xaa, 0xaa,
+    0x02, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0xa0, 0xaa, 0x56, 0x55, 0x55, 0xa5,
+    0x0a, 0x80, 0xaa, 0x56, 0x55, 0x55, 0x95, 0x2a, 0x00, 0xaa, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x00,
+    0xa8, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x80, 0x56,
+    0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00, 0x68, 0x55, 0x55,
+    0x55, 0x95, 0xaa, 0x00, 0xa0, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x80, 0x56, 0x55, 0x55, 0x95,
+    0xaa, 0x02, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0x55, 0xaa, 0x0a,
+    0x00, 0xa0, 0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x95, 0xaa, 0x0a, 0x00, 0x00,
+    0x5a, 0x55, 0x95, 0xaa, 0x0a, 0x00, 0x00, 0x68, 0x55, 0xa5, 0xaa, 0x0a, 0x00, 0x00, 0xa0, 0x55,
+    0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa,
+    0x02, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0xa8, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xa0, 0xaa, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x80, 0xaa, 0x55, 0x55,
+    0x55, 0x55, 0xaa, 0x00, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55,
+    0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0x95, 0x2a,
+    0x00, 0x5a, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x68, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0xa0,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x5a, 0x55,
+    0x55, 0x55, 0xa9, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa9, 0x2a, 0x00, 0xa0, 0x55, 0x55, 0x55,
+    0xa9, 0x2a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xa9, 0x2a, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xa9, 0x2a,
+    0x00, 0x00, 0x68, 0x55, 0x55, 0xaa, 0x2a, 0x00, 0x00, 0xa0, 0x55, 0x95, 0xaa, 0x2a, 0x00, 0x00,
+    0x80, 0x56, 0xa9, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa8,
+    0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a,
+    0xa0, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x80, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x00, 0x5a,
+    0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55,
+    0x55, 0x55, 0x95, 0x2a, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0x5a, 0x55, 0x55, 0x55,
+    0x55, 0xaa, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9,
+    0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00,
+    0x68, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x80, 0x56,
+    0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x68, 0x55, 0x55,
+    0xa5, 0xaa, 0x00, 0x00, 0xa0, 0x55, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x80, 0x56, 0x55, 0xaa, 0xaa,
+    0x00, 0x00, 0x00, 0x5a, 0xa9, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x2a, 0x00, 0x00,
+    0x00, 0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x0a, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xa0, 0x5a, 0x55, 0x55, 0x55,
+    0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5,
+    0x0a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x80,
+    0x56, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55,
+    0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x80, 0x56, 0x55, 0x55,
+    0x55, 0x95, 0x2a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x68, 0x55, 0x55, 0x55, 0x95,
+    0xaa, 0x00, 0xa0, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x80, 0x56, 0x55, 0x55, 0x95, 0xaa, 0x02,
+    0x00, 0x5a, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0xa0,
+    0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x80, 0x56, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55,
+    0xaa, 0xaa, 0x02, 0x00, 0x00, 0x68, 0xa9, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa,
+    0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xa8,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x82, 0x56, 0x55,
+    0x55, 0x55, 0x55, 0xa5, 0x0a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x68, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x2a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55,
+    0xa9, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x2a,
+    0xa0, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x80, 0x56, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x5a,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0x68, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x02, 0xa0, 0x55, 0x55,
+    0x55, 0x55, 0xaa, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55,
+    0xaa, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xaa, 0x0a,
+    0x00, 0x80, 0x56, 0x55, 0x95, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0xa5, 0xaa, 0x0a, 0x00, 0x00,
+    0x68, 0x55, 0xa9, 0xaa, 0x0a, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x80, 0xaa,
+    0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xa0, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x82, 0x56, 0x55, 0x55, 0x55, 0x55, 0x95, 0x0a,
+    0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xa0, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xa9, 0x82, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x5a, 0x55, 0x55,
+    0x55, 0x55, 0x95, 0x0a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0xa0, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0xaa, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9,
+    0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x80,
+    0x56, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa9, 0x2a, 0x00, 0x68, 0x55,
+    0x55, 0x55, 0xa9, 0x2a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xa9, 0x2a, 0x00, 0x80, 0x56, 0x55, 0x55,
+    0xa9, 0x2a, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xaa, 0x2a, 0x00, 0x00, 0x68, 0x55, 0x95, 0xaa, 0x2a,
+    0x00, 0x00, 0xa0, 0x55, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5,
+    0x82, 0x56, 0x55, 0x55, 0x55, 0x55, 0x95, 0x0a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x68,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x80, 0x56, 0x55,
+    0x55, 0x55, 0x55, 0xa9, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55, 0x55, 0x55,
+    0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5,
+    0x2a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00,
+    0xa0, 0x55, 0x55, 0x55, 0xa5, 0x2a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x5a,
+    0x55, 0x55, 0xa9, 0x2a, 0x00, 0x00, 0x68, 0x55, 0x55, 0xaa, 0x2a, 0x00, 0x00, 0xa0, 0x55, 0x95,
+    0xaa, 0x2a, 0x00, 0x00, 0x80, 0x96, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x02,
+    0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x68, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0xa5, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x8a, 0x56, 0x55, 0x55, 0x55,
+    0x55, 0x95, 0x0a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xaa, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x82, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02,
+    0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55,
+    0x55, 0x55, 0x55, 0x95, 0x2a, 0x80, 0x56, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x00, 0x5a, 0x55, 0x55,
+    0x55, 0x95, 0xaa, 0x00, 0x68, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0xa0, 0x55, 0x55, 0x55, 0x95,
+    0xaa, 0x00, 0x80, 0x56, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xa5, 0xaa, 0x00,
+    0x00, 0x68, 0x55, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0xa0, 0x55, 0x55, 0xaa, 0xaa, 0x00, 0x00, 0x80,
+    0x56, 0xa5, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa8, 0xaa,
+    0xaa, 0x02, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xa2,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa0, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xa9, 0x82, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x5a, 0x55, 0x55, 0x55, 0x55,
+    0xa5, 0x0a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a,
+    0x80, 0x56, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x5a, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x68,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0xa0, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x80, 0x56, 0x55,
+    0x55, 0x95, 0xaa, 0x02, 0x00, 0x5a, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0xa5,
+    0xaa, 0x00, 0x00, 0xa0, 0x55, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x80, 0x56, 0x55, 0xaa, 0xaa, 0x00,
+    0x00, 0x00, 0x9a, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00,
+    0xa0, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x5a, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xa5, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9,
+    0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x82, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x68, 0x55, 0x55,
+    0x55, 0x55, 0x95, 0x2a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x80, 0x56, 0x55, 0x55, 0x55,
+    0x55, 0xaa, 0x00, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0x68, 0x55, 0x55, 0x55, 0x55, 0xaa,
+    0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00,
+    0x5a, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0xa0, 0x55,
+    0x55, 0xa5, 0xaa, 0x02, 0x00, 0x80, 0x56, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x00, 0x5a, 0xa5, 0xaa,
+    0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0xaa,
+    0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0x5a,
+    0x55, 0x55, 0x55, 0x55, 0x95, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x56, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x68, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0xa5, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x95,
+    0x0a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0xa0,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x00, 0x5a, 0x55,
+    0x55, 0x55, 0x55, 0xaa, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55,
+    0x55, 0xa9, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xaa,
+    0x02, 0x00, 0x68, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0xa0, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00,
+    0x80, 0x56, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8,
+    0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+    0x55, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x95,
+    0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x5a,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xa2, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x95, 0x0a, 0x5a, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xaa, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x00, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02,
+    0x68, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x80, 0x56,
+    0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x68, 0x55, 0x55,
+    0x55, 0xaa, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x80, 0x56, 0x55, 0x95, 0xaa,
+    0x02, 0x00, 0x00, 0x5a, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x00, 0x68, 0xa9, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0x56,
+    0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x95, 0xaa, 0xaa, 0x5a, 0x55, 0x55,
+    0x55, 0x55, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55,
+    0xa5, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a,
+    0x56, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x68, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56, 0x55, 0x55,
+    0x55, 0x55, 0xa9, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55,
+    0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa9, 0x0a,
+    0x00, 0x5a, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0xa0,
+    0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55,
+    0xa5, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x95, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0x02, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0xaa, 0x56, 0x55, 0x55, 0x55,
+    0x29, 0x00, 0xa8, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x00, 0xa8, 0x5a, 0x55, 0x55, 0x55, 0x95, 0x02,
+    0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x6a,
+    0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0x56, 0x55, 0x55,
+    0x55, 0x55, 0xa5, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa,
+    0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x5a,
+    0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55,
+    0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55,
+    0xa9, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xaa, 0x0a,
+    0x00, 0x80, 0x56, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00,
+    0x68, 0x55, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa,
+    0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xa8,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0xa8, 0x56, 0x55, 0x55, 0x55, 0x29, 0x00, 0xa0, 0x5a, 0x55,
+    0x55, 0x55, 0xa5, 0x00, 0xa0, 0x6a, 0x55, 0x55, 0x55, 0x95, 0x02, 0xa0, 0x6a, 0x55, 0x55, 0x55,
+    0x55, 0x0a, 0xa8, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xa9,
+    0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x95, 0xa2, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa0, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5,
+    0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80,
+    0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x68, 0x55,
+    0x55, 0x55, 0xa9, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x55,
+    0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x55, 0xaa, 0xaa, 0x00,
+    0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a,
+    0x00, 0xa0, 0x56, 0x55, 0x55, 0x55, 0x29, 0x00, 0x80, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x00, 0x80,
+    0x6a, 0x55, 0x55, 0x55, 0x95, 0x02, 0x80, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x80, 0xaa, 0x55,
+    0x55, 0x55, 0x55, 0x29, 0xa8, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+    0x55, 0xa5, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x95, 0xa2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+    0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x68,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56, 0x55,
+    0x55, 0x55, 0x55, 0xa5, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x68, 0x55, 0x55, 0x55,
+    0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5,
+    0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00,
+    0xa0, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x00, 0x5a,
+    0x55, 0x95, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa,
+    0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x55,
+    0x55, 0x29, 0x00, 0x80, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x6a, 0x55, 0x55, 0x55, 0x95,
+    0x02, 0x00, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x29, 0x80,
+    0xaa, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0x55,
+    0x55, 0x55, 0x55, 0x95, 0xa2, 0x56, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x2a, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0xa9, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02,
+    0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55,
+    0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55,
+    0x55, 0xa5, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xa9,
+    0x0a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0x95, 0xaa, 0x02, 0x00,
+    0x00, 0x68, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80,
+    0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00,
+    0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x80, 0x5a, 0x55, 0x55, 0x55, 0x29, 0x00, 0x80, 0x6a,
+    0x55, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x6a, 0x55, 0x55, 0x55, 0x95, 0x02, 0x00, 0xaa, 0x55, 0x55,
+    0x55, 0x55, 0x0a, 0x00, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x29, 0x80, 0xaa, 0x56, 0x55, 0x55, 0x55,
+    0xa9, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x95, 0xa2,
+    0x6a, 0x55, 0x55, 0x55, 0x55, 0x95, 0x8a, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2a, 0x5a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x2a, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa0, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55,
+    0xa5, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a,
+    0x80, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x68,
+    0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x80, 0x56, 0x55,
+    0x55, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x55, 0xa9, 0xaa,
+    0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x0a, 0x00, 0x80, 0xaa, 0x56, 0x55, 0x55, 0x29, 0x00, 0x00, 0xaa, 0x56, 0x55, 0x55, 0xa5, 0x00,
+    0x00, 0xaa, 0x5a, 0x55, 0x55, 0x95, 0x02, 0x00, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x0a, 0x00, 0xaa,
+    0xaa, 0x55, 0x55, 0x55, 0x29, 0x00, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0x55,
+    0x55, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x95, 0xa2, 0xaa, 0xaa, 0x56, 0x55, 0x55,
+    0x95, 0x8a, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x2a, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x2a,
+    0xa8, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9, 0xa0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x68, 0x55, 0x55,
+    0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55,
+    0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa5, 0x0a,
+    0x00, 0xa0, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x00,
+    0x5a, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa,
+    0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x80, 0xaa, 0x5a,
+    0x55, 0x55, 0x29, 0x00, 0x00, 0xaa, 0x6a, 0x55, 0x55, 0xa5, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x55,
+    0x95, 0x02, 0x00, 0xa8, 0xaa, 0x56, 0x55, 0x55, 0x0a, 0x00, 0xa8, 0xaa, 0x56, 0x55, 0x55, 0x2a,
+    0x00, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0xa9, 0x80, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0xa5, 0xaa, 0xaa,
+    0xaa, 0x6a, 0x55, 0x55, 0x95, 0xa2, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x95, 0x8a, 0xaa, 0xaa, 0x6a,
+    0x55, 0x55, 0x55, 0x2a, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x2a, 0xa8, 0xaa, 0x5a, 0x55, 0x55,
+    0x55, 0xa9, 0xa0, 0xaa, 0x56, 0x55, 0x55, 0x55, 0xa9, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0xa9,
+    0x02, 0x5a, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0,
+    0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55,
+    0x55, 0x55, 0xa5, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55,
+    0xa9, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0x95, 0xaa, 0x02,
+    0x00, 0x00, 0x68, 0x55, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00,
+    0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x02,
+    0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0xa0, 0x6a, 0x55, 0x55, 0x29, 0x00, 0x00,
+    0x80, 0xaa, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x00, 0xaa, 0x56, 0x55, 0x95, 0x02, 0x00, 0x00, 0xaa,
+    0x5a, 0x55, 0x55, 0x0a, 0x00, 0x00, 0xaa, 0x5a, 0x55, 0x55, 0x2a, 0x00, 0x00, 0xa8, 0x6a, 0x55,
+    0x55, 0xa9, 0x00, 0x00, 0xa8, 0xaa, 0x55, 0x55, 0xa5, 0x02, 0x00, 0xaa, 0xaa, 0x55, 0x55, 0xa5,
+    0x02, 0x00, 0xaa, 0xaa, 0x55, 0x55, 0x95, 0x0a, 0xa8, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x2a, 0xaa,
+    0xaa, 0xaa, 0x55, 0x55, 0x55, 0x2a, 0xa8, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xa0, 0xaa, 0xaa,
+    0x55, 0x55, 0x55, 0xa9, 0x80, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x5a, 0x55, 0x55, 0x55,
+    0x55, 0xa9, 0x02, 0x68, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa5,
+    0x0a, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa5, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00,
+    0x68, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x80, 0x56,
+    0x55, 0x55, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x55, 0xaa,
+    0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x80, 0xaa, 0xaa,
+    0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x55, 0x29, 0x00, 0x00, 0x00, 0xa8, 0x56, 0x55, 0xa5,
+    0x00, 0x00, 0x00, 0xa8, 0x5a, 0x55, 0x95, 0x02, 0x00, 0x00, 0xa0, 0x6a, 0x55, 0x95, 0x0a, 0x00,
+    0x00, 0xa0, 0x6a, 0x55, 0x55, 0x2a, 0x00, 0x00, 0x80, 0xaa, 0x55, 0x55, 0xa9, 0x00, 0x00, 0x80,
+    0xaa, 0x56, 0x55, 0xa5, 0x00, 0x00, 0x80, 0xaa, 0x56, 0x55, 0xa5, 0x02, 0x00, 0x80, 0xaa, 0x56,
+    0x55, 0x95, 0x0a, 0x00, 0xa0, 0xaa, 0x5a, 0x55, 0x95, 0x2a, 0x00, 0xa8, 0xaa, 0x5a, 0x55, 0x55,
+    0x2a, 0xa8, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0xaa, 0xa0, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa9, 0x80,
+    0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa9, 0x02, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x68, 0x55,
+    0x55, 0x55, 0x55, 0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x80, 0x56, 0x55, 0x55,
+    0x55, 0xa9, 0x0a, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xa9,
+    0x0a, 0x00, 0xa0, 0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0x80, 0x56, 0x55, 0x95, 0xaa, 0x02, 0x00,
+    0x00, 0x5a, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00, 0x68, 0x95, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00,
+    0xa8, 0x56, 0x55, 0x29, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x55, 0xa9, 0x00, 0x00, 0x00, 0xa0, 0x6a,
+    0x55, 0xa5, 0x02, 0x00, 0x00, 0x80, 0x6a, 0x55, 0x95, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0x55, 0x55,
+    0x2a, 0x00, 0x00, 0x00, 0xaa, 0x56, 0x55, 0xa9, 0x00, 0x00, 0x00, 0xaa, 0x56, 0x55, 0xa9, 0x00,
+    0x00, 0x00, 0xaa, 0x5a, 0x55, 0xa5, 0x02, 0x00, 0x00, 0xaa, 0x5a, 0x55, 0x95, 0x0a, 0x00, 0x00,
+    0xaa, 0x6a, 0x55, 0x95, 0x0a, 0x00, 0x00, 0xaa, 0x6a, 0x55, 0x55, 0x2a, 0x00, 0xa0, 0xaa, 0x6a,
+    0x55, 0x55, 0xaa, 0xa0, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0xaa, 0x80, 0xaa, 0xaa, 0x5a, 0x55, 0x55,
+    0xa9, 0x00, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa9, 0x02, 0xa8, 0x6a, 0x55, 0x55, 0x55, 0xa9, 0x02,
+    0xa0, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x5a,
+    0x55, 0x55, 0x55, 0xa9, 0x0a, 0x00, 0x68, 0x55, 0x55, 0x55, 0xaa, 0x0a, 0x00, 0xa0, 0x55, 0x55,
+    0x55, 0xaa, 0x02, 0x00, 0x80, 0x56, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55, 0xa9, 0xaa,
+    0x00, 0x00, 0x00, 0x68, 0xa9, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00,
+    0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa,
+    0x02, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0x56, 0x55, 0x2a, 0x00,
+    0x00, 0x00, 0x80, 0x5a, 0x55, 0xa9, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x55, 0xa5, 0x02, 0x00, 0x00,
+    0x00, 0xaa, 0x55, 0x95, 0x0a, 0x00, 0x00, 0x00, 0xa8, 0x56, 0x55, 0x2a, 0x00, 0x00, 0x00, 0xa8,
+    0x56, 0x55, 0x2a, 0x00, 0x00, 0x00, 0xa8, 0x5a, 0x55, 0xa9, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x55,
+    0xa5, 0x02, 0x00, 0x00, 0xa0, 0x6a, 0x55, 0xa5, 0x0a, 0x00, 0x00, 0xa0, 0x6a, 0x55, 0x95, 0x0a,
+    0x00, 0x00, 0xa8, 0x6a, 0x55, 0x95, 0x2a, 0x00, 0x00, 0xa8, 0x6a, 0x55, 0x55, 0x2a, 0x00, 0x80,
+    0xaa, 0x6a, 0x55, 0x55, 0xaa, 0x80, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0xaa, 0x00, 0xaa, 0xaa, 0x5a,
+    0x55, 0x55, 0xaa, 0x02, 0xa8, 0xaa, 0x56, 0x55, 0x55, 0xa9, 0x02, 0xa0, 0x55, 0x55, 0x55, 0x55,
+    0xa9, 0x02, 0x80, 0x56, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xaa, 0x02,
+    0x00, 0x68, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0xa0, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x80,
+    0x56, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa,
+    0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x5a, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x55,
+    0xa9, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xa5, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x55, 0xa5, 0x02,
+    0x00, 0x00, 0x00, 0xa8, 0x56, 0x95, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x55, 0x2a, 0x00, 0x00,
+    0x00, 0xa0, 0x5a, 0x55, 0xa9, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x55, 0xa9, 0x02, 0x00, 0x00, 0x80,
+    0x6a, 0x55, 0xa5, 0x02, 0x00, 0x00, 0x80, 0xaa, 0x55, 0xa5, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0x55,
+    0x95, 0x2a, 0x00, 0x00, 0xa0, 0xaa, 0x55, 0x95, 0x2a, 0x00, 0x00, 0xa8, 0xaa, 0x55, 0x55, 0xaa,
+    0x00, 0x80, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0x00, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0xaa, 0x00, 0xa8,
+    0xaa, 0x5a, 0x55, 0x55, 0xaa, 0x02, 0xa0, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x80, 0x56, 0x55,
+    0x55, 0x55, 0xaa, 0x02, 0x00, 0x5a, 0x55, 0x55, 0x55, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0x95,
+    0xaa, 0x02, 0x00, 0xa0, 0x55, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x80, 0x56, 0x55, 0xa9, 0xaa, 0x00,
+    0x00, 0x00, 0x5a, 0xa5, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00,
+    0xa0, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0x80, 0x5a, 0x95, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0x55, 0xa9, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x56, 0xa5, 0x02, 0x00, 0x00, 0x00, 0xa0, 0x56,
+    0x95, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x55, 0xaa,
+    0x00, 0x00, 0x00, 0x80, 0x6a, 0x55, 0xa9, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x55, 0xa9, 0x02, 0x00,
+    0x00, 0x80, 0xaa, 0x55, 0xa5, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0x55, 0xa5, 0x0a, 0x00, 0x00, 0x80,
+    0xaa, 0x55, 0x95, 0x2a, 0x00, 0x00, 0xa0, 0xaa, 0x55, 0x95, 0x2a, 0x00, 0x00, 0xa8, 0xaa, 0x55,
+    0x95, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0x55, 0x95, 0xaa, 0x00, 0xa8, 0xaa, 0x6a, 0x55, 0x55, 0xaa,
+    0x00, 0xa0, 0xaa, 0x56, 0x55, 0x95, 0xaa, 0x00, 0x80, 0x56, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00,
+    0x5a, 0x55, 0x55, 0x95, 0xaa, 0x02, 0x00, 0x68, 0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0xa0, 0x55,
+    0x55, 0xa9, 0xaa, 0x00, 0x00, 0x80, 0x56, 0x55, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x9a, 0xaa, 0xaa,
+    0x2a, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa,
+    0xaa, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x95, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x55, 0xa9, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x56, 0xa5, 0x02, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0xa5, 0x0a, 0x00, 0x00, 0x00,
+    0x80, 0x5a, 0x95, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x6a,
+    0x55, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xa9, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xa9,
+    0x02, 0x00, 0x00, 0x00, 0xaa, 0x56, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0x56, 0xa5, 0x0a, 0x00,
+    0x00, 0x80, 0xaa, 0x56, 0x95, 0x2a, 0x00, 0x00, 0xa0, 0xaa, 0x56, 0x95, 0x2a, 0x00, 0x00, 0xaa,
+    0xaa, 0x55, 0x95, 0xaa, 0x00, 0xa8, 0xaa, 0x6a, 0x55, 0x95, 0xaa, 0x00, 0xa0, 0xaa, 0x5a, 0x55,
+    0x95, 0xaa, 0x00, 0x80, 0x56, 0x55, 0x55, 0x95, 0xaa, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xa5, 0xaa,
+    0x00, 0x00, 0x68, 0x55, 0x55, 0xa9, 0xaa, 0x00, 0x00, 0xa0, 0x55, 0x55, 0xaa, 0xaa, 0x00, 0x00,
+    0x80, 0x56, 0xa5, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa8,
+    0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x95, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x68,
+    0x95, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x56, 0xa9,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xa5, 0x02, 0x00, 0x00, 0x00, 0x80, 0x5a, 0x95, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x6a, 0x95, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x00, 0x00, 0x00,
+    0x00, 0xaa, 0x55, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xa9, 0x02, 0x00, 0x00, 0x00, 0xaa,
+    0x56, 0xa9, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x56, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0x56, 0xa5,
+    0x0a, 0x00, 0x00, 0x80, 0xaa, 0x56, 0xa5, 0x2a, 0x00, 0x00, 0xa8, 0xaa, 0x55, 0xa5, 0x2a, 0x00,
+    0xa8, 0xaa, 0xaa, 0x55, 0xa5, 0x2a, 0x00, 0xa0, 0xaa, 0x5a, 0x55, 0xa5, 0x2a, 0x00, 0x80, 0x5a,
+    0x55, 0x55, 0xa5, 0xaa, 0x00, 0x00, 0x5a, 0x55, 0x55, 0xa9, 0x2a, 0x00, 0x00, 0x68, 0x55, 0x55,
+    0xaa, 0x2a, 0x00, 0x00, 0xa0, 0x55, 0x95, 0xaa, 0x2a, 0x00, 0x00, 0x80, 0x96, 0xaa, 0xaa, 0x0a,
+    0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5a, 0xa5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x68, 0x95, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x56, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x5a, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x95,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x95, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x55, 0xaa, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0x55, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x56, 0xa9, 0x02, 0x00, 0x00,
+    0x00, 0xa8, 0x56, 0xa9, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x56, 0xa9, 0x0a, 0x00, 0x00, 0x80, 0xaa,
+    0x56, 0xa9, 0x0a, 0x00, 0x00, 0xa0, 0xaa, 0x55, 0xa9, 0x2a, 0x00, 0xa8, 0xaa, 0xaa, 0x55, 0xa9,
+    0x2a, 0x00, 0xa0, 0xaa, 0x5a, 0x55, 0xa9, 0x2a, 0x00, 0x80, 0x5a, 0x55, 0x55, 0xa9, 0x2a, 0x00,
+    0x00, 0x5a, 0x55, 0x55, 0xaa, 0x2a, 0x00, 0x00, 0x68, 0x55, 0x95, 0xaa, 0x2a, 0x00, 0x00, 0xa0,
+    0x55, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xaa, 0xaa,
+    0xaa, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa9,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x68, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x95, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0xa0, 0x56, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xa9, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x5a, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0xa5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x95, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x95,
+    0xaa, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x56, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x56, 0xaa, 0x02,
+    0x00, 0x00, 0x00, 0xaa, 0x56, 0xaa, 0x02, 0x00, 0x00, 0x80, 0xaa, 0x56, 0xaa, 0x0a, 0x00, 0x00,
+    0xa0, 0xaa, 0x55, 0xaa, 0x0a, 0x00, 0xa8, 0xaa, 0xaa, 0x55, 0xaa, 0x0a, 0x00, 0xa0, 0xaa, 0x5a,
+    0x55, 0xaa, 0x0a, 0x00, 0x80, 0x5a, 0x55, 0x95, 0xaa, 0x0a, 0x00, 0x00, 0x5a, 0x55, 0xa5, 0xaa,
+    0x0a, 0x00, 0x00, 0x68, 0x55, 0xa9, 0xaa, 0x0a, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x02, 0x00,
+    0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x96,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xaa, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6a, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0xa5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x95, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x96, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x96, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x96,
+    0xaa, 0x02, 0x00, 0x00, 0x80, 0xaa, 0x96, 0xaa, 0x02, 0x00, 0x00, 0xa8, 0xaa, 0x95, 0xaa, 0x02,
+    0x00, 0xa8, 0xaa, 0xaa, 0x95, 0xaa, 0x02, 0x00, 0xa0, 0xaa, 0x5a, 0x95, 0xaa, 0x02, 0x00, 0x80,
+    0x56, 0x55, 0xa5, 0xaa, 0x02, 0x00, 0x00, 0x5a, 0x55, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x68, 0xa9,
+    0xaa, 0xaa, 0x02, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x5a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xa9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa8, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xa6, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x9a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x80, 0x6a,
+    0xaa, 0x02, 0x00, 0x00, 0x00, 0x80, 0x6a, 0xa9, 0x02, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa9, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa5, 0x2a, 0x00, 0x00,
+    0x00, 0x80, 0xaa, 0xa6, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xa6, 0xaa, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0xa5, 0xaa, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xa5, 0xaa, 0x00, 0x00, 0xa8, 0xaa, 0x6a, 0xa5,
+    0xaa, 0x00, 0x00, 0xa0, 0xaa, 0x5a, 0xa9, 0xaa, 0x00, 0x00, 0x80, 0x56, 0x55, 0xaa, 0xaa, 0x00,
+    0x00, 0x00, 0x5a, 0xa9, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00,
+    0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9a,
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xa9, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xa6, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x9a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x6a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x80, 0xaa,
+    0xa9, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xa9, 0x0a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xa9, 0x2a,
+    0x00, 0x00, 0x00, 0xa0, 0xaa, 0xa9, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xa9, 0x2a, 0x00, 0x00,
+    0xaa, 0xaa, 0xaa, 0xa9, 0x2a, 0x00, 0x00, 0xa8, 0xaa, 0x6a, 0xaa, 0x2a, 0x00, 0x00, 0xa0, 0xaa,
+    0x96, 0xaa, 0x2a, 0x00, 0x00, 0x80, 0x56, 0xa9, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa,
+    0x2a, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00,
+    0xa0, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0xaa,
+    0xaa, 0x0a, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a,
+    0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0xa0, 0x6a, 0xaa, 0xaa, 0x0a, 0x00, 0x00,
+    0x80, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa8,
+    0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa8,
+    0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa,
+    0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xa8, 0xaa, 0xaa,
+    0xaa, 0x02, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x00,
+    0x00, 0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x2a,
+    0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0,
+    0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00,
+    0xa0, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0xa0, 0xaa, 0xaa,
+    0xaa, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a,
+    0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x80,
+    0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+
+
+const ReachMap reachMaps[4] =
+{
+    { -0.0199999996f, -0.00999999978f, -0.209999993f, 100.0f, 29, 28, 43, cellsA,
+      { -45.0f, 45.0f, -45.0f, 70.0f, -60.0f, 70.0f },
+      { 0.125f, 0.109999999f, 0.00249999994f, 0.0274999999f },
+      { 0.785398185f, 0.0f, 0.0f } },
+    { -0.0199999996f, -0.00999999978f, -0.209999993f, 100.0f, 29, 28, 43, cellsA,
+      { -45.0f, 45.0f, -45.0f, 70.0f, -60.0f, 70.0f },
+      { 0.125f, 0.109999999f, 0.00249999994f, 0.0274999999f },
+      { 0.785398185f, 0.0f, 0.0f } },
+    { -0.0199999996f, -0.00999999978f, -0.209999993f, 100.0f, 29, 28, 43, cellsA,
+      { -45.0f, 45.0f, -45.0f, 70.0f, -60.0f, 70.0f },
+      { 0.125f, 0.109999999f, 0.00249999994f, 0.0274999999f },
+      { 0.785398185f, 0.0f, 0.0f } },
+    { -0.0199999996f, -0.00999999978f, -0.209999993f, 100.0f, 29, 28, 43, cellsA,
+      { -45.0f, 45.0f, -45.0f, 70.0f, -60.0f, 70.0f },
+      { 0.125f, 0.109999999f, 0.00249999994f, 0.0274999999f },
+      { 0.785398185f, 0.0f, 0.0f } }
+};
@@ -1,51 +1,140 @@
 #include "RobotLeg.h"
+#include "FastMath.h"
+#include "LegGeometry.h"
 #include "utility.h"
 
 
 
+// With the geometry fixed at compile time the IK folds it in for the lanes
+// that were given the same at runtime, and reads the lanes for the rest
+#ifdef LEG_GEOMETRY_FIXED
+typedef FixedGeometry<RobotDimensions> SolveGeometry;
+#endif
+
+
+
+LegBatch RobotLeg::kinematics;
+RobotLeg* RobotLeg::lanes[LEG_COUNT];
+int RobotLeg::laneCount = 0;
+unsigned int RobotLeg::fixedLanes = 0;
+
+
+
 RobotLeg::RobotLeg(PinName thetaPin, PinName phiPin, PinName psiPin, bool start) : theta(thetaPin, start), phi(phiPin, start), psi(psiPin, start)
 {
+    // Claim the next lane of the shared kinematics. There are only
+    // LEG_COUNT of them, for the legs of the robot.
+    if (laneCount >= LEG_COUNT) error("RobotLeg: more than %d legs\n", LEG_COUNT);
+    lane = laneCount++;
+    lanes[lane] = this;
+    reach = NULL;
+    
     setDimensions(0.1f, 0.1f, 0.0f, 0.0f);
     setAngleOffsets(0.0f, 0.0f, 0.0f);
     
     state = neutral;
-    stepTime = 0.4f;
-    stepDelta = 3.141593f / stepTime;
-    stepHeight = 0.05f;
+    stepDelay = 0.0f;
+    carried = false;
+}
+
+
+
+void RobotLeg::setStepTime(float t)
+{
+    nextSwing.setStepTime(t);
+}
+
+
+
+void RobotLeg::setStepHeight(float h)
+{
+    nextSwing.setStepHeight(h);
 }
 
 
 
 void RobotLeg::setDimensions(float a, float b, float c, float d)
 {
-    this->a = a;
-    this->b = b;
-    this->c = c;
-    this->d = d;
+    kinematics.a[lane] = a;
+    kinematics.b[lane] = b;
+    kinematics.c[lane] = c;
+    kinematics.d[lane] = d;
+    checkGeometry();
 }
 
 
 
 void RobotLeg::setAngleOffsets(float oth, float oph, float ops)
 {
-    this->oth = oth;
-    this->oph = oph;
-    this->ops = ops;
+    kinematics.oth[lane] = oth;
+    kinematics.oph[lane] = oph;
+    kinematics.ops[lane] = ops;
+    checkGeometry();
+}
+
+
+
+void RobotLeg::checkGeometry()
+{
+#ifdef LEG_GEOMETRY_FIXED
+    const float eps = 0.000001f;
+    bool same = fabs(kinematics.a[lane] - DIM_A) < eps && fabs(kinematics.b[lane] - DIM_B) < eps &&
+                fabs(kinematics.c[lane] - DIM_C) < eps && fabs(kinematics.d[lane] - DIM_D) < eps &&
+                fabs(kinematics.oth[lane] - OFFSET_THETA) < eps && fabs(kinematics.oph[lane] - OFFSET_PHI) < eps &&
+                fabs(kinematics.ops[lane] - OFFSET_PSI) < eps;
+    
+    if (same) fixedLanes |= 1 << lane;
+    else fixedLanes &= ~(1 << lane);
+#endif
 }
 
 
 
 void RobotLeg::setStepCircle(float xc, float yc, float zc, float rc)
 {
-    circleCenter = vector3(xc, yc, zc);
-    circleRadius = rc;
+    kinematics.cx[lane] = xc;
+    kinematics.cy[lane] = yc;
+    kinematics.cz[lane] = zc;
+    kinematics.cr[lane] = rc;
+}
+
+
+
+void RobotLeg::calibrate(const servo_cal_t* cal)
+{
+    // Calibration for theta, phi and psi in that order
+    theta.calibrate(cal[0].pulse1, cal[0].pulse2, cal[0].upper, cal[0].lower);
+    phi.calibrate(cal[1].pulse1, cal[1].pulse2, cal[1].upper, cal[1].lower);
+    psi.calibrate(cal[2].pulse1, cal[2].pulse2, cal[2].upper, cal[2].lower);
+    
+    kinematics.thetaMin[lane] = theta.lowerLimit;
+    kinematics.thetaMax[lane] = theta.upperLimit;
+    kinematics.phiMin[lane] = phi.lowerLimit;
+    kinematics.phiMax[lane] = phi.upperLimit;
+    kinematics.psiMin[lane] = psi.lowerLimit;
+    kinematics.psiMax[lane] = psi.upperLimit;
+}
+
+
+
+void RobotLeg::setReachMap(const ReachMap* map)
+{
+    reach = (map && map->matches(kinematics, lane)) ? map : NULL;
+}
+
+
+
+int RobotLeg::reachability(vector3 dest)
+{
+    // Without a map nothing is known until the IK has been solved
+    return reach ? reach->query(dest) : REACH_EDGE;
 }
 
 
 
 vector3 RobotLeg::getPosition()
 {
-    return (stepping != state) ? position : stepB;
+    return (stepping != state) ? lanePosition() : stepB;
     
     /*const float deg2rad = 0.01745329f;
     vector3 p;
@@ -67,51 +156,55 @@ vector3 RobotLeg::getPosition()
 
 
 
+vector3 RobotLeg::getFootPosition()
+{
+    // Where the foot actually is, including partway through a step
+    return lanePosition();
+}
+
+
+
 float RobotLeg::getStepDistance()
 {
     // Returns distance to step circle edge in the current direction of movement.
-    float vx, vy, m, cosval;
+    return kinematics.stepDistance(lane, nDeltaPosition.x, nDeltaPosition.y);
+}
+
+
+
+void RobotLeg::stepDistances(float* out)
+{
+    float dx[LEG_COUNT];
+    float dy[LEG_COUNT];
     
-    vx = position.x - circleCenter.x;
-    vy = position.y - circleCenter.y;
-    m = sqrt(vx*vx + vy*vy);
-    cosval = (nDeltaPosition.x*vx + nDeltaPosition.y*vy) / 
-        (m * sqrt(nDeltaPosition.x*nDeltaPosition.x + nDeltaPosition.y*nDeltaPosition.y));
+    for (int i = 0; i < LEG_COUNT; ++i)
+    {
+        dx[i] = lanes[i] ? lanes[i]->nDeltaPosition.x : 0.0f;
+        dy[i] = lanes[i] ? lanes[i]->nDeltaPosition.y : 0.0f;
+    }
     
-    return m*cosval + sqrt(pos(circleRadius*circleRadius - m*m*(1.0f - cosval*cosval)));
+    kinematics.stepDistance(dx, dy, out);
 }
 
 
 
 bool RobotLeg::move(vector3 dest)
 {
-    const float pi2 = 1.5707963;
-    const float rad2deg =  57.2958;
-    float L;
+    setTarget(dest);
     
-    position = dest;
+    // Set new angles only if reachable, skipping the IK where the map says
+    // the target can't be
+    if (reach && REACH_OUT == reach->query(dest)) return false;
     
-    // Calculate new angles
-    L = sqrt(dest.x*dest.x + dest.y*dest.y - c*c) - d;
-    thetaAngle = atan2( ((L + d)*dest.y - c*dest.x), ((L + d)*dest.x + c*dest.y) ) - oth;
-    phiAngle = atan2(dest.z, L) + acos((a*a + L*L + dest.z*dest.z - b*b)/(2.0f*a*sqrt(L*L + dest.z*dest.z))) - oph;
-    psiAngle = acos((a*a + b*b - L*L - dest.z*dest.z)/(2.0f*a*b)) - ops - pi2;
+#ifdef LEG_GEOMETRY_FIXED
+    bool solved = ((fixedLanes >> lane) & 1) ? kinematics.solve<SolveGeometry>(lane) : kinematics.solve(lane);
+#else
+    bool solved = kinematics.solve(lane);
+#endif
     
-    // Convert radians to degrees
-    thetaAngle *= rad2deg;
-    phiAngle *= rad2deg;
-    psiAngle *= rad2deg;
-    
-    // Return true if angle is reachable
-    if (thetaAngle <= theta.upperLimit && thetaAngle >= theta.lowerLimit &&
-        phiAngle <= phi.upperLimit && phiAngle >= phi.lowerLimit &&
-        psiAngle <= psi.upperLimit && psiAngle >= psi.lowerLimit)
+    if (solved)
     {
-        // Set new angles
-        theta = thetaAngle;
-        phi = phiAngle;
-        psi = psiAngle;
-    
+        write();
         return true;
     }
     else
@@ -122,10 +215,13 @@ bool RobotLeg::move(vector3 dest)
 
 
 
-void RobotLeg::step(vector3 dest)
+void RobotLeg::step(vector3 dest, float phase)
 {
-    stepA = position;
+    stepA = lanePosition();
     stepB = dest;
+    swing = nextSwing;
+    stepDelay = phase > 0.0f ? phase*swing.stepTime() : 0.0f;
+    carried = false;
 
     stepTimer.reset();
     stepTimer.start();
@@ -134,20 +230,21 @@ void RobotLeg::step(vector3 dest)
 
 
 
-vector3 RobotLeg::reset(float f)
+vector3 RobotLeg::reset(float f, float phase)
 {
     vector3 newPosition;
-    newPosition = circleCenter + nDeltaPosition.unit() * circleRadius * f;
-    step(newPosition);
+    newPosition = laneCircleCenter() + nDeltaPosition.unit() * kinematics.cr[lane] * f;
+    step(newPosition, phase);
     return nDeltaPosition;
 }
 
 
 
-bool RobotLeg::update(const matrix4& deltaTransform)
+bool RobotLeg::update(const rigid2& deltaTransform)
 {
     float t, d;
     vector3 newNDeltaPosition, v;
+    vector3 position = lanePosition();
     const float eps = 0.00001f;
 
     switch (state)
@@ -161,21 +258,32 @@ bool RobotLeg::update(const matrix4& deltaTransform)
             nDeltaPosition = newNDeltaPosition;
         
         // Check if new position is outside the step circle
-        v = newPosition - circleCenter;
+        v = newPosition - laneCircleCenter();
         d = sqrt(v.x*v.x + v.y*v.y);
         
         // Attempt to move to the new position
-        return d < circleRadius;
+        return d < kinematics.cr[lane];
         
     case stepping:
         // Compute new position along step trajectory
-        t = stepTimer.read();
+        t = stepTimer.read() - stepDelay;
         
-        if (t < stepTime)
+        if (t < 0.0f)
         {
-            newPosition.x = stepA.x + (stepB.x - stepA.x)*0.5f*(1 - cos(stepDelta*t));
-            newPosition.y = stepA.y + (stepB.y - stepA.y)*0.5f*(1 - cos(stepDelta*t));
-            newPosition.z = stepA.z + (stepB.z - stepA.z)*stepDelta*t + stepHeight*sin(stepDelta*t);
+            // Not lifted yet, so still planted. Moved with the body by
+            // apply() like a neutral leg, and only if the motion is taken.
+            newPosition = deltaTransform*position;
+            carried = true;
+            return true;
+        }
+        
+        // The step starts from wherever being carried left the foot
+        if (carried) stepA = position;
+        carried = false;
+        
+        if (t < swing.stepTime())
+        {
+            newPosition = swing.position(stepA, stepB, t);
         }
         else
         {
@@ -195,9 +303,48 @@ bool RobotLeg::update(const matrix4& deltaTransform)
 
 
 
+void RobotLeg::shift(const rigid2& t)
+{
+    if (planted()) newPosition = t*newPosition;
+}
+
+
+
 void RobotLeg::apply()
 {
-    if (stepping != state) move(newPosition);
+    if (planted()) move(newPosition);
+}
+
+
+
+void RobotLeg::applyAll()
+{
+    // Same as apply() on every leg, with the IK solved for all lanes at once.
+    // Legs that have lifted already moved in update().
+    unsigned int moving = 0;
+    
+    for (int i = 0; i < laneCount; ++i)
+    {
+        if (lanes[i]->planted())
+        {
+            lanes[i]->setTarget(lanes[i]->newPosition);
+            moving |= 1 << i;
+        }
+    }
+    
+    // One leg with its own geometry takes every lane off the fixed path,
+    // since the lanes are solved together
+#ifdef LEG_GEOMETRY_FIXED
+    unsigned int all = (1u << laneCount) - 1;
+    unsigned int reachable = (fixedLanes & all) == all ? kinematics.solve<SolveGeometry>() : kinematics.solve();
+#else
+    unsigned int reachable = kinematics.solve();
+#endif
+    
+    for (int i = 0; i < laneCount; ++i)
+    {
+        if (moving & reachable & (1 << i)) lanes[i]->write();
+    }
 }
 
 
@@ -206,3 +353,45 @@ bool RobotLeg::getStepping()
 {
     return stepping == state;
 }
+
+
+
+float RobotLeg::stepRemaining()
+{
+    if (state != stepping) return 0.0f;
+    float t = stepDelay + swing.stepTime() - stepTimer.read();
+    return t > 0.0f ? t : 0.0f;
+}
+
+
+
+vector3 RobotLeg::lanePosition()
+{
+    return vector3(kinematics.px[lane], kinematics.py[lane], kinematics.pz[lane]);
+}
+
+
+
+vector3 RobotLeg::laneCircleCenter()
+{
+    return vector3(kinematics.cx[lane], kinematics.cy[lane], kinematics.cz[lane]);
+}
+
+
+
+void RobotLeg::setTarget(vector3 dest)
+{
+    // The position follows the target even if it turns out to be unreachable
+    kinematics.px[lane] = kinematics.tx[lane] = dest.x;
+    kinematics.py[lane] = kinematics.ty[lane] = dest.y;
+    kinematics.pz[lane] = kinematics.tz[lane] = dest.z;
+}
+
+
+
+void RobotLeg::write()
+{
+    theta = kinematics.theta[lane];
+    phi = kinematics.phi[lane];
+    psi = kinematics.psi[lane];
+}
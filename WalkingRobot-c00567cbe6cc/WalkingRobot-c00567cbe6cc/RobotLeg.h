@@ -1,9 +1,20 @@
 #ifndef ROBOTLEG_H
 #define ROBOTLEG_H
 
-#include "mbed.h"
-#include "Servo.h"
+#include "HAL.h"
 #include "Matrix.h"
+#include "LegBatch.h"
+#include "ReachMap.h"
+#include "SwingProfile.h"
+
+
+
+// Pulse widths in microseconds at either end of travel, and the angle limits
+struct servo_cal_t
+{
+    int pulse1, pulse2;
+    float upper, lower;
+};
 
 
 
@@ -11,29 +22,73 @@ class RobotLeg
 {
 public:
     RobotLeg(PinName thetaPin, PinName phiPin, PinName psiPin, bool start = true);
+    
+    // The IK folds in the geometry from LegGeometry.h instead while these
+    // match it and LEG_GEOMETRY_FIXED is defined
     void setDimensions(float a, float b, float c, float d);
     void setAngleOffsets(float oth, float oph, float ops);
+    
     void setStepCircle(float xc, float yc, float zc, float rc);
+    void calibrate(const servo_cal_t* cal);
+    
+    // Map used to reject unreachable targets before the IK. Ignored unless it
+    // was generated for this leg's calibration, so call after calibrate().
+    void setReachMap(const ReachMap* map);
+    int reachability(vector3 dest);
     vector3 getPosition();
+    vector3 getFootPosition();
     float getStepDistance();
     bool move(vector3 dest);
-    void step(vector3 dest);
-    vector3 reset(float f);
-    bool update(const matrix4& deltaTransform);
+    
+    // Steps lift phase steps from now, so two legs can swing overlapped. Until
+    // then the foot stays down and moves with the body through shift() and
+    // apply() like a planted one, but counts as stepping.
+    void step(vector3 dest, float phase = 0.0f);
+    vector3 reset(float f, float phase = 0.0f);
+    bool update(const rigid2& deltaTransform);
+    
+    // Moves a planted leg on by t after update(), keeping the direction it
+    // steps in. Includes a leg waiting to lift.
+    void shift(const rigid2& t);
     void apply();
     bool getStepping();
+    
+    // Swing time and height, taken up at the next step()
+    void setStepTime(float t);
+    void setStepHeight(float h);
+    float getStepTime() { return nextSwing.stepTime(); }
+    float getStepHeight() { return nextSwing.stepHeight(); }
+    
+    // Seconds left of the step in progress, waiting included, 0 if planted
+    float stepRemaining();
+    
+    // Batched versions over every leg
+    static void applyAll();
+    static void stepDistances(float* out);
 
     Servo theta, phi, psi;
     vector3 nDeltaPosition;
+    
+    // Geometry, limits, position and joint angles of every leg live here,
+    // one lane per RobotLeg in order of construction
+    static LegBatch kinematics;
 
 protected:
-    float thetaAngle, phiAngle, psiAngle;
-    float circleRadius;
-    float a, b, c, d;
-    float oth, oph, ops;
-    float stepDelta, stepTime, stepHeight;
-    vector3 circleCenter;
-    vector3 position;
+    vector3 lanePosition();
+    vector3 laneCircleCenter();
+    void setTarget(vector3 dest);
+    void write();
+    void checkGeometry();
+    
+    // On the ground, neutral or stepping but not lifted yet
+    bool planted() { return stepping != state || carried; }
+    
+    int lane;
+    const ReachMap* reach;
+    SwingProfile swing;     // Of the step in progress
+    SwingProfile nextSwing;
+    float stepDelay;        // Before the foot lifts, in seconds
+    bool carried;           // Waiting to lift as of the last update()
     vector3 stepA;
     vector3 stepB;
     vector3 newPosition;
@@ -48,6 +103,9 @@ protected:
 
     Timer stepTimer;
     
+    static RobotLeg* lanes[LEG_COUNT];
+    static int laneCount;
+    static unsigned int fixedLanes; // Lanes with the compiled in geometry
 };
 
 #endif // ROBOTLEG_H
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "Scheduler.h"
+#include "TextOut.h"
+
+
+
+Scheduler scheduler;
+
+
+
+Scheduler::Scheduler()
+{
+    for (int i = 0; i < SCHED_TIERS; ++i)
+        tasks[i] = NULL;
+    released = 0;
+    ticks = 0;
+    requestedUs = 0;
+    periodUs = 0;
+    startTime = 0;
+    releaseTime = 0;
+    resetStats();
+}
+
+
+
+void Scheduler::setTask(sched_tier_t tier, sched_task_t task)
+{
+    tasks[tier] = task;
+}
+
+
+
+void Scheduler::start(float period)
+{
+    periodUs = (uint32_t)(period * 1000000.0f + 0.5f);
+    clock.start();
+    startTime = now();
+    released = 0;
+    ticks = 0;
+    resetStats();
+    ticker.attach_us(this, &Scheduler::release, periodUs);
+}
+
+
+
+void Scheduler::setPeriod(float period)
+{
+    requestedUs = (uint32_t)(period * 1000000.0f + 0.5f);
+}
+
+
+
+void Scheduler::release()
+{
+    ++released;
+}
+
+
+
+void Scheduler::waitRelease()
+{
+    // Release times count from the change. The tick just run keeps its
+    // deadline under the old period.
+    if (requestedUs)
+    {
+        ticker.detach();
+        periodUs = requestedUs;
+        requestedUs = 0;
+        startTime = now();
+        released = 0;
+        ticks = 0;
+        ticker.attach_us(this, &Scheduler::release, periodUs);
+    }
+
+    while (released == ticks)
+    {
+        bool busy = false;
+        for (int i = 0; i < SCHED_TIERS && released == ticks; ++i)
+        {
+            if (!tasks[i]) continue;
+
+            uint32_t t0 = now();
+            bool more = tasks[i]();
+            uint32_t t = now() - t0;
+            if (t > taskMax[i]) taskMax[i] = t;
+
+            if (more)
+            {
+                busy = true;
+                break;
+            }
+        }
+        if (busy) continue;
+
+        // A release between the check and the sleep still wakes it, as the
+        // interrupt stays pending until they are enabled again
+        uint32_t t0 = now();
+        __disable_irq();
+        if (released == ticks) sleep();
+        __enable_irq();
+        slept += now() - t0;
+    }
+
+    // Run for the latest release only
+    uint32_t n = released;
+    overruns += n - ticks - 1;
+    ticks = n;
+    releaseTime = startTime + n*periodUs;
+
+    // The ticker and the clock may round differently by a microsecond
+    int32_t late = now() - releaseTime;
+    jitter.add(late > 0 ? late : 0);
+}
+
+
+
+void Scheduler::tickDone()
+{
+    if (now() - releaseTime > periodUs) ++deadlineMisses;
+}
+
+
+
+void Scheduler::resetStats()
+{
+    overruns = 0;
+    deadlineMisses = 0;
+    jitter.clear();
+    for (int i = 0; i < SCHED_TIERS; ++i)
+        taskMax[i] = 0;
+    slept = 0;
+    statsStart = now();
+}
+
+
+
+int Scheduler::print(char* buf, int len)
+{
+    TextLine line(buf, len);
+    uint32_t elapsed = now() - statsStart;
+
+    line.text("releases ").number((unsigned long)ticks).text(", overruns ").number((unsigned long)overruns);
+    line.text(", deadline misses ").number((unsigned long)deadlineMisses).text(", idle ");
+    line.fixed(elapsed ? 100.0f * slept / elapsed : 0.0f, 1).text("%\n");
+
+    line.text("stage             count      min      p50      p99      max\n");
+    line.text("jitter", 14).put(' ').number((unsigned long)jitter.count, 8).put(' ');
+    line.number((unsigned long)(jitter.count ? jitter.min : 0), 8).put(' ');
+    line.number((unsigned long)jitter.percentile(0.5f), 8).put(' ');
+    line.number((unsigned long)jitter.percentile(0.99f), 8).put(' ');
+    line.number((unsigned long)jitter.max, 8).text("  (us)\n");
+
+    line.text("longest task us:");
+    for (int i = 0; i < SCHED_TIERS; ++i)
+        line.put(' ').text(name((sched_tier_t)i)).put(' ').number((unsigned long)taskMax[i]);
+    line.put('\n');
+
+    return line.length();
+}
+
+
+
+const char* Scheduler::name(sched_tier_t tier)
+{
+    static const char* names[SCHED_TIERS] =
+    {
+        "radio",
+        "telemetry",
+        "log",
+        "terminal"
+    };
+
+    return names[tier];
+}
@@ -0,0 +1,91 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "HAL.h"
+#include "Profiler.h"
+
+// Releases the control tick from a Ticker at a fixed rate, and fills the time
+// in between with background work in priority order. Release times are
+// counted from start(), so a late tick delays the next one without moving the
+// ones after it. Background tasks are not preempted by a release: each has to
+// do a bounded piece of work per call, and the longest of them bounds the
+// jitter of the tick. With nothing left to do the processor sleeps until the
+// next interrupt.
+//
+// All times are in microseconds.
+
+
+
+// Background tiers, highest priority first. The control tick is above all of
+// them.
+enum sched_tier_t
+{
+    SCHED_RADIO,            // Radio driver, before anything that uses it
+    SCHED_TELEMETRY,        // Frames back to the controller
+    SCHED_LOG,              // Log file
+    SCHED_TERMINAL,         // Terminal output
+    SCHED_TIERS
+};
+
+// A background task does one bounded piece of work and returns true if it
+// has more to do straight away. The tiers above it get another look first.
+typedef bool (*sched_task_t)();
+
+
+
+class Scheduler
+{
+public:
+    Scheduler();
+
+    void setTask(sched_tier_t tier, sched_task_t task);
+
+    // Starts releasing ticks every period seconds
+    void start(float period);
+
+    // Changes the period from the next release on. Safe from a terminal
+    // command; the ticker is restarted between ticks.
+    void setPeriod(float period);
+    float period() { return (requestedUs ? requestedUs : periodUs) * 0.000001f; }
+
+    // Runs background work until the next release, and returns at the start
+    // of the tick. Releases missed by a late tick are skipped and counted,
+    // not made up for in a burst.
+    void waitRelease();
+
+    // At the end of every tick
+    void tickDone();
+
+    void resetStats();
+
+    // Counters, jitter in the same layout as Profiler::print, and the longest
+    // call of each tier. Returns the number of characters written.
+    int print(char* buf, int len);
+
+    static const char* name(sched_tier_t tier);
+
+    uint32_t ticks;         // Latest release served, counting from 1
+    uint32_t overruns;      // Releases skipped because a tick ran late
+    uint32_t deadlineMisses; // Ticks that ended after the next release
+    StageHistogram jitter;  // Release to tick start
+    uint32_t taskMax[SCHED_TIERS];
+    uint32_t slept;         // Time asleep since the stats were reset
+    uint32_t statsStart;
+
+private:
+    void release();
+    uint32_t now() { return clock.read_us(); }
+
+    Ticker ticker;
+    Timer clock;
+    sched_task_t tasks[SCHED_TIERS];
+    volatile uint32_t released; // Counted by the ticker
+    volatile uint32_t requestedUs; // New period, 0 for none
+    uint32_t periodUs;
+    uint32_t startTime;
+    uint32_t releaseTime;   // Of the tick being run
+};
+
+extern Scheduler scheduler;
+
+#endif // SCHEDULER_H
@@ -0,0 +1,90 @@
+#include "StepPlanner.h"
+
+
+
+StepPlanner::StepPlanner()
+{
+    speed = 1.0f;
+    lift = -1;
+    count = 0;
+}
+
+
+
+// Fastest speed at which every leg in order lifts before its edge, with the
+// first lifting at start and the rest straight after one another
+float StepPlanner::schedule(const float* edge, float start, float stepTime)
+{
+    float s = 1.0f;
+    float t = start;
+
+    // A foot already past its edge is late whatever the speed
+    for (int k = 0; k < count; ++k)
+    {
+        float e = edge[order[k]];
+        if (t > 0.0f && e > 0.0f && e < s*t) s = e / t;
+        t += stepTime;
+    }
+    return s;
+}
+
+
+
+void StepPlanner::plan(const float* edge, const float* remaining, const float* stability, float stepTime, float lookahead)
+{
+    // The step in progress, if any, has to land first
+    float busy = 0.0f;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (remaining[i] > busy) busy = remaining[i];
+    }
+
+    // Earliest edge first, which is the best order for steps of equal length
+    count = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (remaining[i] > 0.0f) continue;
+        int k = count++;
+        for (; k > 0 && edge[order[k - 1]] > edge[i]; --k)
+            order[k] = order[k - 1];
+        order[k] = i;
+    }
+
+    // A leg that cannot lift yet gives way to the earliest one that can, if
+    // that one would otherwise run out of circle before its turn
+    for (int k = 1; k < count && stability[order[0]] <= BORDER_MIN; ++k)
+    {
+        int i = order[k];
+        if (stability[i] <= BORDER_MIN) continue;
+        if (edge[i] < busy + k*stepTime)
+        {
+            for (; k > 0; --k)
+                order[k] = order[k - 1];
+            order[0] = i;
+        }
+        break;
+    }
+
+    speed = 1.0f;
+    lift = -1;
+    if (!count) return;
+
+    // With the next leg held down there is no schedule to keep to, only
+    // moving on until its margin comes back
+    int first = order[0];
+    if (stability[first] <= BORDER_MIN) return;
+
+    speed = schedule(edge, busy, stepTime);
+    if (busy > 0.0f)
+    {
+        // Slow down as the next leg's margin runs out, rather than stop
+        float ramp = (stability[first] - BORDER_MIN) / (BORDER_MAX - BORDER_MIN);
+        if (ramp < speed) speed = ramp;
+    }
+    else
+    {
+        // Lift now if waiting for the next plan would cost speed, or the
+        // margin will not last
+        if (stability[first] <= BORDER_MAX || schedule(edge, lookahead, stepTime) < speed) lift = first;
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef STEPPLANNER_H
+#define STEPPLANNER_H
+
+#include "HAL.h"
+
+// Support margins in metres. A leg may only lift while its margin is above
+// the minimum, and below the maximum it should lift soon, since the margin
+// shrinks as the body moves on.
+#define BORDER_MAX 0.015f
+#define BORDER_MIN 0.007f
+
+
+
+// Lookahead footstep planner. Puts the planted legs in the order they reach
+// the edge of their step circles at the commanded speed, lays their steps
+// end to end after any step in progress, and finds the fastest the body can
+// go with every foot lifted before it runs out of circle. Rather than
+// freezing while a step is in progress the body slows down, and legs are
+// lifted as late as keeps that speed, so strides stay long.
+//
+// Times are in seconds. Edge times are at the full commanded speed.
+class StepPlanner
+{
+public:
+    StepPlanner();
+
+    // edge: time until each planted leg leaves its circle, remaining: time
+    // left of each step in progress, 0 for planted legs, stability: support
+    // margin of each leg. lookahead is how long until the next plan.
+    void plan(const float* edge, const float* remaining, const float* stability, float stepTime, float lookahead);
+
+    float speed;            // Fraction of the commanded speed to move at
+    int lift;               // Leg to lift now, or -1
+    int order[4];           // Planted legs in the order they will step
+    int count;
+
+private:
+    float schedule(const float* edge, float start, float stepTime);
+};
+
+#endif // STEPPLANNER_H
@@ -0,0 +1,244 @@
+#include "SupportPolygon.h"
+
+
+
+// Feet anticlockwise round the body: A, C, B, D, and where each one is
+static const int ring[4] = { 0, 2, 1, 3 };
+static const int ringPosition[4] = { 0, 2, 1, 3 };
+
+// Edge between each pair of feet, and the edges each foot is on
+static const int edgeIndex[4][4] =
+{
+    { -1, 0, 1, 2 },
+    { 0, -1, 3, 4 },
+    { 1, 3, -1, 5 },
+    { 2, 4, 5, -1 }
+};
+static const int edgeFeet[6][2] = { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 2 }, { 1, 3 }, { 2, 3 } };
+static const unsigned int footEdges[4] = { 0x07, 0x19, 0x2a, 0x34 };
+
+
+
+SupportPolygon::SupportPolygon()
+{
+    comX = comY = 0.0f;
+    invalidate();
+}
+
+
+
+void SupportPolygon::invalidate()
+{
+    for (int i = 0; i < 4; ++i)
+        fx[i] = fy[i] = 0.0f;
+    body.identity();
+    lifted = 0;
+    staleFeet = 0x0f;
+    validEdges = 0;
+    prepared = false;
+}
+
+
+
+void SupportPolygon::setFoot(int i, const vector3& p)
+{
+    if (isLifted(i))
+    {
+        air[i] = p;
+    }
+    else
+    {
+        vector3 q = body.inverse()*p;
+        fx[i] = q.x;
+        fy[i] = q.y;
+    }
+    staleFeet &= ~(1 << i);
+    validEdges &= ~footEdges[i];
+    prepared = false;
+}
+
+
+
+void SupportPolygon::lift(int i, const vector3& p)
+{
+    lifted |= 1 << i;
+    setFoot(i, p);
+}
+
+
+
+void SupportPolygon::land(int i)
+{
+    // Take the motion so far into the planted feet, so the anchored frame
+    // stays with the body and rounding doesn't build up in it
+    for (int k = 0; k < 4; ++k)
+    {
+        if (isLifted(k)) continue;
+        vector3 q = body*vector3(fx[k], fy[k], 0.0f);
+        fx[k] = q.x;
+        fy[k] = q.y;
+    }
+    body.identity();
+    validEdges = 0;
+
+    lifted &= ~(1 << i);
+    fx[i] = air[i].x;
+    fy[i] = air[i].y;
+    prepared = false;
+}
+
+
+
+void SupportPolygon::move(const rigid2& motion)
+{
+    body = motion*body;
+    prepared = false;
+}
+
+
+
+void SupportPolygon::setCom(float x, float y)
+{
+    comX = x;
+    comY = y;
+    prepared = false;
+}
+
+
+
+void SupportPolygon::prepare()
+{
+    if (prepared) return;
+
+    rigid2 anchor = body.inverse();
+    vector3 o = anchor*vector3(comX, comY, 0.0f);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        if (!isLifted(i)) continue;
+        vector3 q = anchor*air[i];
+        fx[i] = q.x;
+        fy[i] = q.y;
+        validEdges &= ~footEdges[i];
+    }
+
+    // Edges from the lower numbered foot, so inwards when that one comes
+    // first going anticlockwise
+    for (int e = 0; e < 6; ++e)
+    {
+        int a = edgeFeet[e][0];
+        int b = edgeFeet[e][1];
+        if (!((validEdges >> e) & 1))
+        {
+            float lx = fx[b] - fx[a];
+            float ly = fy[b] - fy[a];
+            float inv = 1.0f / sqrtf(lx*lx + ly*ly);
+            nx[e] = -ly*inv;
+            ny[e] = lx*inv;
+            nc[e] = nx[e]*fx[a] + ny[e]*fy[a];
+        }
+        dist[e] = nx[e]*o.x + ny[e]*o.y - nc[e];
+    }
+    validEdges = 0x3f;
+    prepared = true;
+}
+
+
+
+// Signed distance of the centre of mass inside the edge from foot p to q,
+// going anticlockwise
+float SupportPolygon::edge(int p, int q) const
+{
+    return p < q ? dist[edgeIndex[p][q]] : -dist[edgeIndex[q][p]];
+}
+
+
+
+// Margin over the polygon of the given feet. On two feet the body can only
+// balance on the line between them, and on fewer there is no support.
+float SupportPolygon::polygonMargin(unsigned int feet) const
+{
+    int v[4];
+    int n = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+        if ((feet >> ring[k]) & 1) v[n++] = ring[k];
+    }
+
+    if (n < 2) return -1.0f;
+    if (n == 2) return -fabs(edge(v[0], v[1]));
+
+    float m = edge(v[n - 1], v[0]);
+    for (int k = 0; k + 1 < n; ++k)
+    {
+        float d = edge(v[k], v[k + 1]);
+        if (d < m) m = d;
+    }
+    return m;
+}
+
+
+
+float SupportPolygon::margin()
+{
+    prepare();
+    return polygonMargin(0x0f & ~lifted);
+}
+
+
+
+void SupportPolygon::liftMargins(float* out)
+{
+    // Lifted feet count where they will land. Without a foot the polygon
+    // keeps the two outer edges away from it and cuts across between its
+    // neighbours.
+    prepare();
+    float outer[4];
+    for (int k = 0; k < 4; ++k)
+        outer[k] = edge(ring[k], ring[(k + 1) & 3]);
+    for (int k = 0; k < 4; ++k)
+    {
+        float m = edge(ring[(k + 3) & 3], ring[(k + 1) & 3]);
+        if (outer[(k + 1) & 3] < m) m = outer[(k + 1) & 3];
+        if (outer[(k + 2) & 3] < m) m = outer[(k + 2) & 3];
+        out[ring[k]] = m;
+    }
+}
+
+
+
+void SupportPolygon::diagonalMargins(float* out)
+{
+    prepare();
+    for (int k = 0; k < 4; ++k)
+        out[ring[k]] = edge(ring[(k + 3) & 3], ring[(k + 1) & 3]);
+}
+
+
+
+float SupportPolygon::liftEdge(int i, vector3* inward)
+{
+    prepare();
+    int k = ringPosition[i];
+    int v[3] = { ring[(k + 1) & 3], ring[(k + 2) & 3], ring[(k + 3) & 3] };
+
+    int p = v[0], q = v[1];
+    float m = edge(p, q);
+    for (int j = 1; j < 3; ++j)
+    {
+        float d = edge(v[j], v[(j + 1) % 3]);
+        if (d < m)
+        {
+            m = d;
+            p = v[j];
+            q = v[(j + 1) % 3];
+        }
+    }
+
+    // Back from the anchored frame to the robot's
+    int e = p < q ? edgeIndex[p][q] : edgeIndex[q][p];
+    float x = p < q ? nx[e] : -nx[e];
+    float y = p < q ? ny[e] : -ny[e];
+    *inward = vector3(body.c*x - body.s*y, body.s*x + body.c*y, 0.0f);
+    return m;
+}
@@ -0,0 +1,76 @@
+#ifndef SUPPORTPOLYGON_H
+#define SUPPORTPOLYGON_H
+
+#include "HAL.h"
+#include "Matrix.h"
+
+
+
+// Support polygon of the four feet and the margins of the centre of mass
+// over it, updated as feet lift and land rather than rebuilt every plan.
+//
+// Planted feet don't move on the ground, so they are kept in the robot frame
+// as it was when a foot last landed, together with the body motion since.
+// The edges between them only change when a foot does, and the margin to
+// each is a dot product with a cached normal. A lifted foot counts where it
+// will land, which moves with the body, so only its edges are recomputed.
+//
+// Feet go round the body in the order A, C, B, D, anticlockwise, since each
+// stays in its own quadrant. Margins are in metres, positive with the centre
+// of mass inside.
+class SupportPolygon
+{
+public:
+    SupportPolygon();
+
+    // Positions are in robot coordinates. A lifted foot is at the point it
+    // will land, fixed to the body until it does.
+    void setFoot(int i, const vector3& p);
+    void lift(int i, const vector3& p);
+    void land(int i);
+    bool isLifted(int i) const { return (lifted >> i) & 1; }
+
+    // Feet moved without the polygon knowing, so all need setFoot again
+    void invalidate();
+    unsigned int stale() const { return staleFeet; }
+
+    // The body moved by motion, carrying the planted feet
+    void move(const rigid2& motion);
+
+    // Centre of mass projected on the ground
+    void setCom(float x, float y);
+    vector3 com() const { return vector3(comX, comY, 0.0f); }
+
+    // Margin on the feet down now, and with each foot lifted as well
+    float margin();
+    void liftMargins(float* out);
+
+    // Margin over just the line between the two neighbours of each foot,
+    // the rule lifts are decided by. Ignores the outer edges, so never below
+    // liftMargins().
+    void diagonalMargins(float* out);
+
+    // Margin with foot i lifted, and the inward unit normal of the edge it
+    // is measured to. Moving the centre of mass along it raises the margin.
+    float liftEdge(int i, vector3* inward);
+
+private:
+    void prepare();
+    float edge(int p, int q) const;
+    float polygonMargin(unsigned int feet) const;
+
+    float fx[4], fy[4];     // Anchored frame, lifted feet as of the last prepare()
+    vector3 air[4];         // Landing points of lifted feet
+    rigid2 body;            // Robot frame from the anchored frame
+    float comX, comY;
+    unsigned int lifted, staleFeet;
+
+    // Unit normal and offset of the line through each pair of feet, inwards
+    // for the lower numbered foot first, and the centre of mass's distance
+    float nx[6], ny[6], nc[6];
+    float dist[6];
+    unsigned int validEdges;
+    bool prepared;          // Distances are up to date
+};
+
+#endif // SUPPORTPOLYGON_H
@@ -0,0 +1,66 @@
+#include "SwingProfile.h"
+
+
+
+// One extra entry past the end repeats the last, so the lerp at u = 1 needs
+// no special case
+float SwingProfile::glideTable[SWING_SEGMENTS + 2];
+float SwingProfile::liftTable[SWING_SEGMENTS + 2];
+bool SwingProfile::built = false;
+
+
+
+SwingProfile::SwingProfile()
+{
+    if (!built) build();
+
+    height = 0.05f;
+    setStepTime(0.4f);
+}
+
+
+
+void SwingProfile::build()
+{
+    for (int i = 0; i <= SWING_SEGMENTS; ++i)
+    {
+        float u = (float)i / SWING_SEGMENTS;
+        float v = 1.0f - u;
+        glideTable[i] = u*u*u*(10.0f + u*(-15.0f + u*6.0f));
+        liftTable[i] = 64.0f*u*u*u*v*v*v;
+    }
+    glideTable[SWING_SEGMENTS + 1] = glideTable[SWING_SEGMENTS];
+    liftTable[SWING_SEGMENTS + 1] = liftTable[SWING_SEGMENTS];
+    built = true;
+}
+
+
+
+void SwingProfile::setStepTime(float t)
+{
+    time = t;
+    rate = SWING_SEGMENTS / t;
+}
+
+
+
+void SwingProfile::setStepHeight(float h)
+{
+    height = h;
+}
+
+
+
+vector3 SwingProfile::position(const vector3& a, const vector3& b, float t) const
+{
+    float u = t*rate;
+    if (u < 0.0f) u = 0.0f;
+    if (u > SWING_SEGMENTS) u = SWING_SEGMENTS;
+
+    int i = (int)u;
+    float f = u - i;
+    float s = glideTable[i] + (glideTable[i + 1] - glideTable[i])*f;
+    float h = liftTable[i] + (liftTable[i + 1] - liftTable[i])*f;
+
+    return vector3(a.x + (b.x - a.x)*s, a.y + (b.y - a.y)*s, a.z + (b.z - a.z)*s + height*h);
+}
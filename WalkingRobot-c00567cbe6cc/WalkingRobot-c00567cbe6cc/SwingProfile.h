@@ -0,0 +1,46 @@
+#ifndef SWINGPROFILE_H
+#define SWINGPROFILE_H
+
+#include "HAL.h"
+#include "Matrix.h"
+
+// Table segments over one swing. The linear interpolation error of either
+// profile is below 0.1% of the stride or the step height.
+#define SWING_SEGMENTS 64
+
+
+
+// Swing foot trajectory from precomputed profiles. The foot glides along the
+// minimum jerk curve 10u^3 - 15u^4 + 6u^5 from the start to the end of the
+// step, and rises and falls by 64u^3(1-u)^3 times the step height, with u
+// the fraction of the swing done. Both start and end with zero velocity and
+// acceleration, so the foot leaves and meets the ground without a jolt.
+//
+// The profiles are sampled once for all legs and only scaled by the step
+// time and height, so either can change at any time for no more than a
+// multiply. Evaluating takes two table lookups and lerps, where the old
+// cosine trajectory took a sine and cosine.
+class SwingProfile
+{
+public:
+    SwingProfile();
+
+    void setStepTime(float t);
+    void setStepHeight(float h);
+    float stepTime() const { return time; }
+    float stepHeight() const { return height; }
+
+    // Position t seconds into a swing from a to b, t in [0, stepTime]
+    vector3 position(const vector3& a, const vector3& b, float t) const;
+
+private:
+    float time, height;
+    float rate;             // Table segments per second of the swing
+
+    static float glideTable[SWING_SEGMENTS + 2];
+    static float liftTable[SWING_SEGMENTS + 2];
+    static bool built;
+    static void build();
+};
+
+#endif // SWINGPROFILE_H
@@ -0,0 +1,201 @@
+#include "TextOut.h"
+#include "SPSCQueue.h"
+#include <cstring>
+
+
+
+TextOut textOut(USBTX, USBRX);
+
+static const uint32_t powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+
+
+TextLine::TextLine(char* buf, int size) : truncated(false), buf(buf), size(size), used(0)
+{
+    if (size > 0) buf[0] = 0;
+}
+
+
+
+TextLine& TextLine::put(char c)
+{
+    if (used + 1 < size)
+    {
+        buf[used++] = c;
+        buf[used] = 0;
+    }
+    else
+    {
+        truncated = true;
+    }
+    return *this;
+}
+
+
+
+// n characters of s, after enough spaces to make width
+TextLine& TextLine::field(const char* s, int n, int width)
+{
+    for (int i = n; i < width; ++i)
+        put(' ');
+    for (int i = 0; i < n; ++i)
+        put(s[i]);
+    return *this;
+}
+
+
+
+TextLine& TextLine::text(const char* s, int width)
+{
+    int n = 0;
+    for (; s[n]; ++n)
+        put(s[n]);
+    for (; n < width; ++n)
+        put(' ');
+    return *this;
+}
+
+
+
+TextLine& TextLine::number(unsigned long value, int width)
+{
+    char digits[20];    // Enough for a 64 bit long on the host
+    int n = sizeof(digits);
+
+    do
+    {
+        digits[--n] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+
+    return field(digits + n, sizeof(digits) - n, width);
+}
+
+
+
+TextLine& TextLine::number(long value, int width)
+{
+    if (value >= 0) return number((unsigned long)value, width);
+
+    char digits[21];    // 64 bit long on the host and the sign
+    int n = sizeof(digits);
+    unsigned long v = 0ul - (unsigned long)value;
+
+    do
+    {
+        digits[--n] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    digits[--n] = '-';
+
+    return field(digits + n, sizeof(digits) - n, width);
+}
+
+
+
+TextLine& TextLine::hex(uint32_t value, int digits)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+
+    for (int i = digits - 1; i >= 0; --i)
+        put(hexDigits[(value >> 4*i) & 0xf]);
+    return *this;
+}
+
+
+
+TextLine& TextLine::fixed(float value, int decimals, int width)
+{
+    if (value != value) return field("nan", 3, width);
+    if (decimals < 0) decimals = 0;
+    if (decimals > 6) decimals = 6;
+
+    // One float multiply, then all integer
+    float scaled = (value < 0.0f ? -value : value) * powers[decimals];
+    if (!(scaled < 4294967040.0f)) return field("ovf", 3, width);
+    uint32_t n = (uint32_t)(scaled + 0.5f);
+    bool negative = value < 0.0f && n;
+
+    // Sign, at most 10 digits and the point
+    char digits[12];
+    int i = sizeof(digits);
+    for (int d = 0; d < decimals; ++d)
+    {
+        digits[--i] = '0' + n % 10;
+        n /= 10;
+    }
+    if (decimals) digits[--i] = '.';
+    do
+    {
+        digits[--i] = '0' + n % 10;
+        n /= 10;
+    } while (n);
+    if (negative) digits[--i] = '-';
+
+    return field(digits + i, sizeof(digits) - i, width);
+}
+
+
+
+TextOut::TextOut(PinName tx, PinName rx) : dropped(0), sent(0), serial(tx, rx), head(0), tail(0)
+{
+}
+
+
+
+bool TextOut::write(const char* text)
+{
+    return write(text, strlen(text));
+}
+
+
+
+bool TextOut::write(const char* text, int length)
+{
+    // Commands may run from the Terminal's interrupt as well as the main
+    // loop, so the producer side is a short critical section
+    __disable_irq();
+    unsigned int h = head;
+    if (length > (int)(TEXTOUT_RING - (h - tail)))
+    {
+        ++dropped;
+        __enable_irq();
+        return false;
+    }
+
+    // At most two copies, either side of the end of the ring
+    unsigned int start = h & (TEXTOUT_RING - 1);
+    unsigned int first = TEXTOUT_RING - start;
+    if (first > (unsigned int)length) first = length;
+    memcpy(ring + start, text, first);
+    memcpy(ring, text + first, length - first);
+    SPSC_BARRIER();
+    head = h + length;
+    __enable_irq();
+    return true;
+}
+
+
+
+int TextOut::space()
+{
+    return TEXTOUT_RING - (head - tail);
+}
+
+
+
+void TextOut::service()
+{
+    unsigned int t = tail;
+    unsigned int h = head;
+
+    SPSC_BARRIER();
+    while (t != h && serial.writeable())
+    {
+        serial.putc(ring[t & (TEXTOUT_RING - 1)]);
+        ++t;
+        ++sent;
+    }
+    SPSC_BARRIER();
+    tail = t;
+}
@@ -0,0 +1,85 @@
+#ifndef TEXTOUT_H
+#define TEXTOUT_H
+
+#include "HAL.h"
+
+// Terminal output that never waits on the UART. Commands copy finished lines
+// into a RAM ring and service() hands them to the UART between ticks, only
+// as fast as its transmit FIFO takes them. A line that does not fit is
+// dropped whole and counted, so a command costs the same however slow the
+// serial link is.
+//
+// The ring is not drained from the UART interrupt: mbed sends each UART's
+// interrupt to the Serial object constructed last, which is the Terminal's.
+#define TEXTOUT_RING 2048       // Characters, a power of two
+
+
+
+// Builds a line in a caller's buffer without printf. Numbers are converted
+// with integer arithmetic only, floats in fixed point. Anything past the end
+// of the buffer is cut off and the text stays terminated.
+class TextLine
+{
+public:
+    TextLine(char* buf, int size);
+
+    // Left aligned and padded to width
+    TextLine& text(const char* s, int width = 0);
+
+    // Right aligned in width
+    TextLine& number(long value, int width = 0);
+    TextLine& number(unsigned long value, int width = 0);
+
+    // Always the given number of digits, lower case
+    TextLine& hex(uint32_t value, int digits);
+
+    // Rounded to 0 to 6 decimals and right aligned in width. NaN comes out as
+    // "nan" and anything too big for 32 bits once scaled as "ovf".
+    TextLine& fixed(float value, int decimals, int width = 0);
+
+    TextLine& put(char c);
+
+    const char* str() const { return buf; }
+    int length() const { return used; }
+    bool truncated;
+
+private:
+    TextLine& field(const char* s, int n, int width);
+
+    char* buf;
+    int size;
+    int used;
+};
+
+
+
+class TextOut
+{
+public:
+    TextOut(PinName tx, PinName rx);
+
+    // Queues the whole text or none of it. Safe from interrupts and the
+    // main loop alike.
+    bool write(const char* text);
+    bool write(const char* text, int length);
+
+    // Room left in the ring, in characters
+    int space();
+
+    // Call between ticks. Fills the UART FIFO from the ring without waiting.
+    void service();
+
+    uint32_t dropped;       // Lines that did not fit
+    uint32_t sent;          // Characters handed to the UART
+
+    Serial serial;
+
+private:
+    char ring[TEXTOUT_RING];
+    volatile unsigned int head; // Written with interrupts off
+    volatile unsigned int tail; // Only service() moves it
+};
+
+extern TextOut textOut;
+
+#endif // TEXTOUT_H
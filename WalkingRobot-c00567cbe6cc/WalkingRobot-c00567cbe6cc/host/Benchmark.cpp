@@ -0,0 +1,2075 @@
+// Host benchmarks
+//
+// usage: Benchmark [name...]
+//
+// With no arguments every benchmark is run. Cycle counts come from the host
+// cycle counter; the same stage breakdown is available on the robot through
+// the "prof" terminal command.
+
+#ifdef HAL_POSIX
+
+#include "Gait.h"
+#include "Profiler.h"
+#include "DataLog.h"
+#include "TextOut.h"
+#include "Scheduler.h"
+#include "FastMath.h"
+#include "LegBatch.h"
+#include "ReachMap.h"
+#include "Radio.h"
+#include "nRF24L01P_sim.h"
+#include "nRF24L01P_defs.h"
+#include "SPSCQueue.h"
+#include "SwingProfile.h"
+#include "SupportPolygon.h"
+#include <pthread.h>
+#include <string>
+#include <algorithm>
+#include <sched.h>
+
+
+
+// Controller words cycled through by the control loop benchmarks: forward,
+// strafe, turn, diagonal while turning, and standing still
+static const uint32_t pattern[] = { 0x00009c00, 0x00000064, 0x00400000, 0x00c09c64, 0x00000000 };
+
+
+
+static void printProfile(float period)
+{
+    char buf[256];
+
+    printf("stage             count      min      p50      p99      max  (cycles @ %lu Hz)\n",
+           (unsigned long)cycleFrequency());
+    for (int i = 0; i < PROFILE_STAGES; ++i)
+    {
+        profiler.print(buf, sizeof(buf), (profile_stage_t)i);
+        printf("%s", buf);
+    }
+    printf("budget at %.0f Hz: p99 %.3f%%, max %.3f%%\n",
+           1.0f/period, 100.0f*profiler.budget(period, false), 100.0f*profiler.budget(period, true));
+}
+
+
+
+static void benchLoop()
+{
+    const int ticks = 200000;
+    const int phase = 1000; // 5 s per controller pattern
+
+    setupLegs();
+    setupTransforms();
+    profiler.reset();
+
+    for (int i = 0; i < ticks; ++i)
+    {
+        wait(PERIOD);
+        controlTick(pattern[(i/phase) % (sizeof(pattern)/sizeof(pattern[0]))]);
+    }
+
+    printProfile(PERIOD);
+}
+
+
+
+// Time a loop over a sample array and return cycles per call. The sum keeps
+// the calls from being optimized away.
+#define TIME_CALLS(result, n, expr) \
+    do \
+    { \
+        float sum = 0.0f; \
+        uint32_t c0 = cycleCount(); \
+        for (int i = 0; i < n; ++i) sum += (expr); \
+        result = (float)(cycleCount() - c0) / n; \
+        sink += sum; \
+    } while (0)
+
+static volatile float sink;
+
+
+
+static void benchTrig()
+{
+    const int n = 1 << 16;
+    const float rad2deg = 57.2958f;
+    static float ys[n], xs[n], us[n];
+
+    // Samples covering the ranges seen in RobotLeg::move
+    srand(1);
+    for (int i = 0; i < n; ++i)
+    {
+        ys[i] = (rand() / (float)RAND_MAX) * 0.6f - 0.3f;
+        xs[i] = (rand() / (float)RAND_MAX) * 0.6f - 0.3f;
+        us[i] = (rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+    }
+
+    float libAtan2, libAcos, fastAtan2Cycles, fastAcosCycles;
+    TIME_CALLS(libAtan2, n, atan2f(ys[i], xs[i]));
+    TIME_CALLS(fastAtan2Cycles, n, fastAtan2(ys[i], xs[i]));
+    TIME_CALLS(libAcos, n, acosf(us[i]));
+    TIME_CALLS(fastAcosCycles, n, fastAcos(us[i]));
+
+    // Worst case error against double precision libm, in degrees
+    double errAtan2 = 0.0, errAcos = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+        errAtan2 = fmax(errAtan2, fabs(fastAtan2(ys[i], xs[i]) - atan2((double)ys[i], (double)xs[i])));
+        errAcos = fmax(errAcos, fabs(fastAcos(us[i]) - acos((double)us[i])));
+    }
+    errAtan2 *= rad2deg;
+    errAcos *= rad2deg;
+
+    printf("function     libm cyc   fast cyc   speedup   max err deg\n");
+    printf("atan2        %8.1f   %8.1f   %6.2fx   %.6f\n", libAtan2, fastAtan2Cycles, libAtan2/fastAtan2Cycles, errAtan2);
+    printf("acos         %8.1f   %8.1f   %6.2fx   %.6f\n", libAcos, fastAcosCycles, libAcos/fastAcosCycles, errAcos);
+
+    // A joint angle combines at most two of the functions
+    float bound = FASTMATH_MAX_ERROR_DEG;
+    float worst = 2.0f * fmax(errAtan2, errAcos);
+    printf("joint error bound %.6f deg (spec %.6f), servo resolution %.4f deg/us: %s\n",
+           worst, 2.0f*bound, servoResolution(),
+           (worst <= 2.0f*bound && 2.0f*bound < servoResolution()) ? "PASS" : "FAIL");
+}
+
+
+
+// Fill a kinematics batch with the robot's geometry and reachable targets
+static void setupBatch(LegBatch& k)
+{
+    for (int i = 0; i < LEG_COUNT; ++i)
+    {
+        k.a[i] = DIM_A;
+        k.b[i] = DIM_B;
+        k.c[i] = DIM_C;
+        k.d[i] = DIM_D;
+        k.oth[i] = OFFSET_THETA;
+        k.oph[i] = OFFSET_PHI;
+        k.ops[i] = OFFSET_PSI;
+        k.thetaMin[i] = servoCalibration[i][0].lower;
+        k.thetaMax[i] = servoCalibration[i][0].upper;
+        k.phiMin[i] = servoCalibration[i][1].lower;
+        k.phiMax[i] = servoCalibration[i][1].upper;
+        k.psiMin[i] = servoCalibration[i][2].lower;
+        k.psiMax[i] = servoCalibration[i][2].upper;
+        k.cx[i] = CIRCLE_X;
+        k.cy[i] = CIRCLE_Y;
+        k.cz[i] = CIRCLE_Z;
+        k.cr[i] = CIRCLE_R;
+        k.tx[i] = k.px[i] = CIRCLE_X + 0.02f*i;
+        k.ty[i] = k.py[i] = CIRCLE_Y - 0.01f*i;
+        k.tz[i] = k.pz[i] = CIRCLE_Z;
+    }
+}
+
+
+
+static void benchIK()
+{
+    const int n = 1 << 18;
+    static LegBatch k;
+    float dx[LEG_COUNT] = { 0.0f, 0.01f, 0.01f, -0.01f };
+    float dy[LEG_COUNT] = { 0.01f, 0.0f, -0.01f, 0.01f };
+    float out[LEG_COUNT];
+    float perLeg, batched, distPerLeg, distBatched;
+    unsigned int mask = 0;
+
+    setupBatch(k);
+
+    TIME_CALLS(perLeg, n, (float)(k.solve(0) + k.solve(1) + k.solve(2) + k.solve(3)));
+    TIME_CALLS(batched, n, (float)(mask = k.solve()));
+    TIME_CALLS(distPerLeg, n, k.stepDistance(0, dx[0], dy[0]) + k.stepDistance(1, dx[1], dy[1]) +
+                              k.stepDistance(2, dx[2], dy[2]) + k.stepDistance(3, dx[3], dy[3]));
+    TIME_CALLS(distBatched, n, (k.stepDistance(dx, dy, out), out[0] + out[1] + out[2] + out[3]));
+
+    printf("all four legs      per leg cyc   batched cyc   speedup\n");
+    printf("ik + reachability  %11.1f   %11.1f   %6.2fx\n", perLeg, batched, perLeg/batched);
+    printf("step distance      %11.1f   %11.1f   %6.2fx\n", distPerLeg, distBatched, distPerLeg/distBatched);
+    printf("reachable mask 0x%x\n", mask);
+}
+
+
+
+static void benchGeometry()
+{
+    typedef FixedGeometry<RobotDimensions> Fixed;
+    const int n = 1 << 18;
+    static LegBatch k;
+    float laneOne, fixedOne, laneAll, fixedAll;
+
+    setupBatch(k);
+
+    TIME_CALLS(laneOne, n, (float)k.solve<LaneGeometry>(i & 3));
+    TIME_CALLS(fixedOne, n, (float)k.solve<Fixed>(i & 3));
+    // Moving one foot each call keeps the batch from being hoisted
+    TIME_CALLS(laneAll, n, (k.tz[i & 3] = CIRCLE_Z + 0.001f*(i & 1), (float)k.solve<LaneGeometry>()));
+    TIME_CALLS(fixedAll, n, (k.tz[i & 3] = CIRCLE_Z + 0.001f*(i & 1), (float)k.solve<Fixed>()));
+
+    // Both must give the same angles, the invariants are only folded
+    float worst = 0.0f;
+    for (int i = 0; i < LEG_COUNT; ++i)
+    {
+        k.solve<LaneGeometry>(i);
+        float th = k.theta[i], ph = k.phi[i], ps = k.psi[i];
+        k.solve<Fixed>(i);
+        worst = fmax(worst, fmax(fabs(th - k.theta[i]), fmax(fabs(ph - k.phi[i]), fabs(ps - k.psi[i]))));
+    }
+
+    printf("ik                 runtime cyc   fixed cyc   saving\n");
+    printf("one leg            %11.1f   %9.1f   %5.1f%%\n", laneOne, fixedOne, 100.0f*(1.0f - fixedOne/laneOne));
+    printf("all four legs      %11.1f   %9.1f   %5.1f%%\n", laneAll, fixedAll, 100.0f*(1.0f - fixedAll/laneAll));
+    printf("max angle difference %.6f deg\n", worst);
+
+    // A leg given other links has to be solved with its own, on the single
+    // leg and the batched path, while the others stay on the fixed one
+    setupLegs();
+    resetLegs();
+    legD.setDimensions(DIM_A + 0.01f, DIM_B, DIM_C, DIM_D);
+    rigid2 still;
+    for (int i = 0; i < 4; ++i)
+        leg[i]->update(still);
+    RobotLeg::applyAll();
+    LegBatch own = RobotLeg::kinematics;
+    LegBatch fixed = RobotLeg::kinematics;
+    own.solve();
+    fixed.solve<Fixed>();
+    float batchDiff = 0.0f, fixedDiff = 0.0f;
+    for (int i = 0; i < LEG_COUNT; ++i)
+        batchDiff = fmax(batchDiff, fabs(own.phi[i] - RobotLeg::kinematics.phi[i]));
+    fixedDiff = fabs(fixed.phi[3] - own.phi[3]);
+    legD.move(legD.getPosition() + vector3(0.0f, 0.0f, 0.005f));
+    own = RobotLeg::kinematics;
+    own.solve(3);
+    float moveDiff = fabs(own.phi[3] - RobotLeg::kinematics.phi[3]);
+    setupLegs();
+    resetLegs();
+    printf("other links: batched %.6f deg, one leg %.6f deg off their own IK, %.2f deg off the fixed: %s\n",
+           batchDiff, moveDiff, fixedDiff, (batchDiff < 0.0001f && moveDiff < 0.0001f && fixedDiff > 0.1f) ? "PASS" : "FAIL");
+}
+
+
+
+static void benchReach()
+{
+    const int n = 1 << 16;
+    const ReachMap& map = reachMaps[0];
+    static LegBatch k;
+    static float xs[n], ys[n], zs[n];
+    float queryCycles, ikCycles;
+    int counts[3] = { 0, 0, 0 };
+    int wrong = 0;
+
+    setupBatch(k);
+    printf("map for leg A %s its calibration\n", map.matches(k, 0) ? "matches" : "does NOT match");
+
+    // Other angle offsets move the whole workspace, so the map is stale
+    k.oth[0] += 0.01f;
+    bool stale = !map.matches(k, 0);
+    setupBatch(k);
+    printf("map rejected for other angle offsets: %s\n", stale ? "PASS" : "FAIL");
+
+    // Targets spread over the whole grid
+    srand(1);
+    for (int i = 0; i < n; ++i)
+    {
+        xs[i] = map.x0 + (rand() / (float)RAND_MAX) * map.nx / map.invCell;
+        ys[i] = map.y0 + (rand() / (float)RAND_MAX) * map.ny / map.invCell;
+        zs[i] = map.z0 + (rand() / (float)RAND_MAX) * map.nz / map.invCell;
+    }
+
+    TIME_CALLS(queryCycles, n, (float)map.query(xs[i], ys[i], zs[i]));
+    TIME_CALLS(ikCycles, n, (k.tx[0] = xs[i], k.ty[0] = ys[i], k.tz[0] = zs[i], (float)k.solve(0)));
+
+    // A cell must never claim the opposite of what the IK finds
+    for (int i = 0; i < n; ++i)
+    {
+        int cell = map.query(xs[i], ys[i], zs[i]);
+        k.tx[0] = xs[i];
+        k.ty[0] = ys[i];
+        k.tz[0] = zs[i];
+        bool ok = k.solve(0);
+        counts[cell]++;
+        if ((REACH_OUT == cell && ok) || (REACH_IN == cell && !ok)) ++wrong;
+    }
+
+    printf("query %.1f cyc, ik %.1f cyc\n", queryCycles, ikCycles);
+    printf("targets out %d, in %d, edge %d, misclassified %d\n",
+           counts[REACH_OUT], counts[REACH_IN], counts[REACH_EDGE], wrong);
+}
+
+
+
+static void benchInverse()
+{
+    const int n = 1 << 12;
+    static matrix4 ms[n];
+    float generalCycles, rigidCycles;
+    double err = 0.0;
+    int rejected = 0;
+    matrix4 id;
+
+    // Random rotations about every axis plus translations, like the leg and
+    // body transforms
+    srand(1);
+    for (int i = 0; i < n; ++i)
+    {
+        ms[i].rotateX((rand() / (float)RAND_MAX) * 6.2831853f);
+        ms[i].rotateY((rand() / (float)RAND_MAX) * 6.2831853f);
+        ms[i].rotateZ((rand() / (float)RAND_MAX) * 6.2831853f);
+        ms[i].translate(vector3(rand() / (float)RAND_MAX - 0.5f, rand() / (float)RAND_MAX - 0.5f, rand() / (float)RAND_MAX - 0.5f));
+    }
+
+    TIME_CALLS(generalCycles, n, ms[i].inverse().a14);
+    TIME_CALLS(rigidCycles, n, ms[i].inverseRigid().a14);
+
+    // Both inverses must agree, and M*inverse must be the identity
+    for (int i = 0; i < n; ++i)
+    {
+        matrix4 g = ms[i].inverse();
+        matrix4 r = ms[i].inverseRigid();
+        matrix4 p = ms[i]*r;
+        const float* gf = &g.a11;
+        const float* rf = &r.a11;
+        const float* pf = &p.a11;
+        const float* idf = &id.a11;
+        for (int j = 0; j < 12; ++j)
+        {
+            err = fmax(err, fabs(gf[j] - rf[j]));
+            err = fmax(err, fabs(pf[j] - idf[j]));
+        }
+    }
+
+    // A shear is not a rigid transform and must be caught by the check
+    for (int i = 0; i < n; ++i)
+    {
+        matrix4 m = ms[i];
+        m.a12 += 0.01f;
+        if (!m.isRigid(0.0001f)) ++rejected;
+    }
+
+    printf("inverse            general cyc   rigid cyc   speedup\n");
+    printf("matrix4            %11.1f   %9.1f   %6.2fx\n", generalCycles, rigidCycles, generalCycles/rigidCycles);
+    printf("max difference %.2e, sheared matrices rejected %d of %d: %s\n",
+           err, rejected, n, (err < 1e-5 && rejected == n) ? "PASS" : "FAIL");
+}
+
+
+
+// The matrix code as it was before Matrix.h went header only, for comparison
+#define NOINLINE __attribute__((noinline))
+
+static NOINLINE matrix4 multiplyOutOfLine(const matrix4& m, const matrix4& other)
+{
+    matrix4 result;
+
+    result.a11 = m.a11*other.a11 + m.a12*other.a21 + m.a13*other.a31;
+    result.a12 = m.a11*other.a12 + m.a12*other.a22 + m.a13*other.a32;
+    result.a13 = m.a11*other.a13 + m.a12*other.a23 + m.a13*other.a33;
+    result.a14 = m.a11*other.a14 + m.a12*other.a24 + m.a13*other.a34 + m.a14;
+
+    result.a21 = m.a21*other.a11 + m.a22*other.a21 + m.a23*other.a31;
+    result.a22 = m.a21*other.a12 + m.a22*other.a22 + m.a23*other.a32;
+    result.a23 = m.a21*other.a13 + m.a22*other.a23 + m.a23*other.a33;
+    result.a24 = m.a21*other.a14 + m.a22*other.a24 + m.a23*other.a34 + m.a24;
+
+    result.a31 = m.a31*other.a11 + m.a32*other.a21 + m.a33*other.a31;
+    result.a32 = m.a31*other.a12 + m.a32*other.a22 + m.a33*other.a32;
+    result.a33 = m.a31*other.a13 + m.a32*other.a23 + m.a33*other.a33;
+    result.a34 = m.a31*other.a14 + m.a32*other.a24 + m.a33*other.a34 + m.a34;
+
+    return result;
+}
+
+static NOINLINE vector3 transformOutOfLine(const matrix4& m, const vector3& other)
+{
+    vector3 result;
+
+    result.x = m.a11*other.x + m.a12*other.y + m.a13*other.z + m.a14;
+    result.y = m.a21*other.x + m.a22*other.y + m.a23*other.z + m.a24;
+    result.z = m.a31*other.x + m.a32*other.y + m.a33*other.z + m.a34;
+
+    return result;
+}
+
+
+
+static void benchMatrix()
+{
+    const int n = 1 << 12;
+    static matrix4 ms[n];
+    static vector3 ps[n];
+    float composeOld, composeNew, pointOld, pointNew;
+    double err = 0.0;
+
+    srand(1);
+    for (int i = 0; i < n; ++i)
+    {
+        ms[i].rotateX((rand() / (float)RAND_MAX) * 6.2831853f);
+        ms[i].rotateZ((rand() / (float)RAND_MAX) * 6.2831853f);
+        ms[i].translate(vector3(rand() / (float)RAND_MAX - 0.5f, rand() / (float)RAND_MAX - 0.5f, 0.0f));
+        ps[i] = vector3(rand() / (float)RAND_MAX, rand() / (float)RAND_MAX, rand() / (float)RAND_MAX);
+    }
+
+    // Chains of three transforms, and feet through a transform
+    TIME_CALLS(composeOld, n, multiplyOutOfLine(multiplyOutOfLine(ms[i], ms[(i + 1) & (n - 1)]), ms[(i + 2) & (n - 1)]).a14);
+    TIME_CALLS(composeNew, n, (ms[i]*ms[(i + 1) & (n - 1)]*ms[(i + 2) & (n - 1)]).a14);
+    TIME_CALLS(pointOld, n, transformOutOfLine(ms[i & 3], ps[i]).x);
+    TIME_CALLS(pointNew, n, (ms[i & 3]*ps[i]).x);
+
+    for (int i = 0; i < n; ++i)
+    {
+        matrix4 a = multiplyOutOfLine(ms[i], ms[(i + 1) & (n - 1)]);
+        matrix4 b = ms[i]*ms[(i + 1) & (n - 1)];
+        const float* af = &a.a11;
+        const float* bf = &b.a11;
+        for (int j = 0; j < 12; ++j)
+            err = fmax(err, fabs(af[j] - bf[j]));
+    }
+
+#if defined(MATRIX_SSE)
+    const char* path = "SSE";
+#elif defined(MATRIX_NEON)
+    const char* path = "NEON";
+#else
+    const char* path = "scalar";
+#endif
+    printf("matrix (%s)        out of line cyc   header cyc   speedup\n", path);
+    printf("compose 3 matrices    %12.1f   %10.1f   %6.2fx\n", composeOld, composeNew, composeOld/composeNew);
+    printf("transform point       %12.1f   %10.1f   %6.2fx\n", pointOld, pointNew, pointOld/pointNew);
+    printf("max difference %.2e\n", err);
+}
+
+
+
+// Catches what the radio under test sends
+class CaptureAir : public SimAir
+{
+public:
+    CaptureAir() : count(0), length(0) {}
+
+    virtual bool transmitted(nRF24L01P_sim* /*from*/, int /*channel*/, const uint8_t* /*address*/, int /*addressWidth*/,
+                             const uint8_t* payload, int length, uint8_t* /*ack*/, int* /*ackLength*/)
+    {
+        ++count;
+        this->length = length;
+        memcpy(data, payload, length);
+        return false;
+    }
+
+    int count;
+    int length;
+    uint8_t data[FRAME_MAX_LENGTH];
+};
+
+
+
+// Controller word as a one message frame, returns its length
+static int controllerFrame(uint32_t word, uint8_t* data)
+{
+    radio_frame_t frame;
+    frame.seq = (uint8_t)word;
+    frame.types = 1<<MSG_CONTROLLER;
+    frame.controller = word;
+    return encodeFrame(frame, data);
+}
+
+static volatile bool txDoneFlag;
+
+static void onTransmitDone()
+{
+    txDoneFlag = true;
+}
+
+
+
+static void benchRadio()
+{
+    // The robot's radio on the pins from main.cpp, against the register model
+    static nRF24L01P_sim chip(p7, p16, p17, p18);
+    static Radio radio(p5, p6, p7, p16, p17, p18);
+    static CaptureAir air;
+    const uint8_t address[3] = { CTRL_BASE_ADDRESS_1, CTRL_BASE_ADDRESS_2, CTRL_BASE_ADDRESS_3 };
+    const int rounds = 1000;
+    int errors = 0;
+
+    chip.setAir(&air);
+    radio.reset();
+
+    printf("packets   service cyc   spi bytes   old driver bytes\n");
+    for (int burst = 1; burst <= 3; ++burst)
+    {
+        uint32_t cycles = 0;
+        unsigned long bytes = SimSPI::bytes(p7);
+
+        for (int r = 0; r < rounds; ++r)
+        {
+            uint32_t sent = 0;
+            for (int i = 0; i < burst; ++i)
+            {
+                sent = 0x00010000*r + 0x100*burst + i;
+                uint8_t payload[FRAME_MAX_LENGTH];
+                chip.receivePacket(RF_CHANNEL, address, 3, payload, controllerFrame(sent, payload));
+            }
+
+            uint32_t c0 = cycleCount();
+            radio.service();
+            cycles += cycleCount() - c0;
+
+            if (radio.poll().controller != sent) ++errors;
+        }
+
+        // The old handler read FIFO_STATUS and STATUS before every payload,
+        // FIFO_STATUS once more at the end, then cleared RX_DR. Counted for
+        // a fixed payload of the same length as the frame.
+        uint8_t frame[FRAME_MAX_LENGTH];
+        printf("%7d   %11.1f   %9.1f   %16d\n", burst, (float)cycles/rounds,
+               (float)(SimSPI::bytes(p7) - bytes)/rounds, (5 + controllerFrame(0, frame))*burst + 4);
+    }
+
+    // Transmit returns at once and completes through the IRQ
+    txDoneFlag = false;
+    radio.attachTransmitDone(&onTransmitDone);
+    uint64_t t0 = SimClock::now();
+    uint32_t c0 = cycleCount();
+    uint8_t frame[FRAME_MAX_LENGTH];
+    int frameLength = controllerFrame(0x12345678, frame);
+    bool started = radio.transmit(frame, frameLength);
+    uint32_t txCycles = cycleCount() - c0;
+    bool refused = !radio.transmit(frame, frameLength);
+    while (!txDoneFlag && SimClock::now() - t0 < 10000)
+    {
+        wait_us(5);
+        radio.service();
+    }
+
+    printf("transmit call %lu cyc, done after %lu us, second call refused %s, sent %s\n",
+           (unsigned long)txCycles, (unsigned long)(SimClock::now() - t0), refused ? "yes" : "no",
+           (air.count == 1 && air.length == frameLength && !memcmp(air.data, frame, frameLength)) ? "ok" : "WRONG");
+    printf("lost or wrong packets %d: %s\n", errors,
+           (errors == 0 && started && refused && txDoneFlag && air.count == 1) ? "PASS" : "FAIL");
+}
+
+
+// Frame with random contents, restricted to messages that fit together
+static void randomFrame(radio_frame_t& f)
+{
+    do f.types = rand() & ((1<<MSG_TYPES) - 2);
+    while (frameLength(f.types) > FRAME_MAX_LENGTH);
+
+    f.seq = rand();
+    f.controller = (uint32_t)rand() << 16 ^ rand();
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+            f.feet[i][j] = rand();
+        f.stability[i] = rand();
+    }
+    f.period = rand();
+    f.tick = rand();
+    f.tickMax = rand();
+    f.superframe = rand();
+    f.latencyFrame = rand();
+    f.latency = rand();
+    f.latencyP99 = rand();
+    f.latencyMax = rand();
+}
+
+
+
+static bool sameFrame(const radio_frame_t& a, const radio_frame_t& b)
+{
+    if (a.seq != b.seq || a.types != b.types) return false;
+    if ((a.types & (1<<MSG_CONTROLLER)) && a.controller != b.controller) return false;
+    if ((a.types & (1<<MSG_FEET)) && memcmp(a.feet, b.feet, sizeof(a.feet))) return false;
+    if ((a.types & (1<<MSG_STABILITY)) && memcmp(a.stability, b.stability, sizeof(a.stability))) return false;
+    if ((a.types & (1<<MSG_TIMING)) && (a.period != b.period || a.tick != b.tick || a.tickMax != b.tickMax)) return false;
+    if ((a.types & (1<<MSG_SYNC)) && a.superframe != b.superframe) return false;
+    if ((a.types & (1<<MSG_LATENCY)) && (a.latencyFrame != b.latencyFrame || a.latency != b.latency ||
+                                        a.latencyP99 != b.latencyP99 || a.latencyMax != b.latencyMax)) return false;
+    return true;
+}
+
+
+
+// Connects two simulated radios
+class LinkAir : public SimAir
+{
+public:
+    LinkAir(nRF24L01P_sim* a, nRF24L01P_sim* b) : a(a), b(b), lost(0), dropEvery(0), count(0) {}
+
+    virtual bool transmitted(nRF24L01P_sim* from, int channel, const uint8_t* address, int addressWidth,
+                             const uint8_t* payload, int length, uint8_t* ack, int* ackLength)
+    {
+        // Drops every dropEvery'th packet, before the receiver sees it
+        if (dropEvery && ++count % dropEvery == 0) return false;
+        if (!(from == a ? b : a)->receivePacket(channel, address, addressWidth, payload, length, ack, ackLength))
+        {
+            ++lost;
+            return false;
+        }
+        return *ackLength >= 0;
+    }
+
+    nRF24L01P_sim* a;
+    nRF24L01P_sim* b;
+    int lost;
+    int dropEvery;
+    int count;
+};
+
+
+
+// Controller and robot radios joined by a LinkAir
+struct LinkRig
+{
+    LinkRig() : robotChip(p9, p10, p12, p20), ctrlChip(p21, p22, p27, p28),
+                robot(p5, p6, p9, p10, p12, p20), ctrl(p5, p6, p21, p22, p27), air(&robotChip, &ctrlChip)
+    {
+        robotChip.setAir(&air);
+        ctrlChip.setAir(&air);
+    }
+
+    nRF24L01P_sim robotChip;
+    nRF24L01P_sim ctrlChip;
+    Radio robot;
+    RadioController ctrl;
+    LinkAir air;
+};
+
+// There can only be one, the pins are fixed
+static LinkRig& linkRig()
+{
+    static LinkRig rig;
+    return rig;
+}
+
+struct link_result_t
+{
+    int exchanges;
+    int control;            // Controller words the robot got
+    int telemetry;          // Telemetry frames the controller got intact
+    int lostOnAir;
+    uint32_t robotCycles;   // Robot driver time, all exchanges
+    uint32_t robotDeafUs;   // Time the robot was out of PRX
+    link_stats_t stats;
+};
+
+
+
+// Control frames every 20 ms, each answered by one telemetry frame. Frames
+// are compared with what was sent; with ack payloads the telemetry that comes
+// back is the frame loaded before the controller frame went out.
+static void runLink(radio_link_t mode, int dropEvery, int exchanges, link_result_t& result)
+{
+    LinkRig& rig = linkRig();
+    radio_frame_t sent, got;
+    bool loaded = false;
+
+    memset(&result, 0, sizeof(result));
+    result.exchanges = exchanges;
+    rig.air.dropEvery = dropEvery;
+    rig.air.count = 0;
+    rig.air.lost = 0;
+    rig.robot.reset(mode);
+    rig.ctrl.reset(mode);
+    rig.robot.poll();
+    srand(2);
+
+    for (int r = 0; r < exchanges; ++r)
+    {
+        uint32_t c0, word = 0x01000000u*(r & 0xff) + r + 1;
+
+        if (mode == LINK_ACK_PAYLOAD && !rig.robot.ackPending())
+        {
+            randomFrame(sent);
+            sent.types &= ~(1<<MSG_CONTROLLER);
+            c0 = cycleCount();
+            loaded = rig.robot.setAckPayload(sent);
+            result.robotCycles += cycleCount() - c0;
+        }
+
+        rig.ctrl.transmit(word);
+        while (rig.ctrl.transmitting())
+        {
+            wait_us(10);
+            rig.ctrl.service();
+        }
+        c0 = cycleCount();
+        rig.robot.service();
+        result.robotCycles += cycleCount() - c0;
+        if (rig.robot.poll().controller == word) ++result.control;
+
+        if (mode == LINK_TURNAROUND)
+        {
+            randomFrame(sent);
+            sent.types &= ~(1<<MSG_CONTROLLER);
+            uint64_t t0 = SimClock::now();
+            c0 = cycleCount();
+            loaded = rig.robot.transmit(sent);
+            for (int i = 0; i < 100 && rig.robot.transmitting(); ++i)
+            {
+                result.robotCycles += cycleCount() - c0;
+                wait_us(10);
+                c0 = cycleCount();
+                rig.robot.service();
+            }
+            result.robotCycles += cycleCount() - c0;
+            result.robotDeafUs += SimClock::now() - t0;
+        }
+
+        if (rig.ctrl.receive(got) && loaded && sameFrame(sent, got)) ++result.telemetry;
+        wait_ms(20);
+    }
+
+    result.lostOnAir = rig.air.lost;
+    result.stats = rig.ctrl.linkStats();
+}
+
+
+
+// Air time at 2 Mbps as the register model counts it, settling included
+static float airTime(int length)
+{
+    return TIMING_Tstby2a + ((1 + 3 + length + 1)*8 + 9) * 0.5f;
+}
+
+
+
+static void benchProtocol()
+{
+    const int rounds = 200000;
+    uint8_t data[FRAME_MAX_LENGTH + 8];
+    radio_frame_t in, out;
+    int errors = 0;
+
+    // Every frame that fits decodes back to itself
+    srand(1);
+    uint32_t encodeCycles = 0, decodeCycles = 0;
+    for (int r = 0; r < rounds; ++r)
+    {
+        randomFrame(in);
+        uint32_t c0 = cycleCount();
+        int length = encodeFrame(in, data);
+        uint32_t c1 = cycleCount();
+        bool ok = decodeFrame(data, length, out);
+        uint32_t c2 = cycleCount();
+        encodeCycles += c1 - c0;
+        decodeCycles += c2 - c1;
+        if (length != frameLength(in.types) || !ok || !sameFrame(in, out)) ++errors;
+    }
+    printf("round trip: %d frames, encode %.1f cyc, decode %.1f cyc, errors %d\n",
+           rounds, (float)encodeCycles/rounds, (float)decodeCycles/rounds, errors);
+
+    // Fuzz with random bytes and with damaged valid frames. Whatever decodes
+    // has to encode back to the same bytes, and nothing may read past the
+    // end; the input is copied to the end of a heap block so a sanitizer
+    // build catches that.
+    int accepted = 0, mismatched = 0;
+    for (int r = 0; r < rounds; ++r)
+    {
+        int length;
+        if (r & 1)
+        {
+            length = rand() % (sizeof(data) + 1);
+            for (int i = 0; i < length; ++i)
+                data[i] = (r & 2) ? rand() % (MSG_TYPES + 1) : rand();
+        }
+        else
+        {
+            randomFrame(in);
+            length = encodeFrame(in, data);
+            int flips = 1 + rand() % 3;
+            for (int i = 0; i < flips; ++i)
+            {
+                switch (rand() % 3)
+                {
+                case 0: if (length) data[rand() % length] ^= 1 << (rand() % 8); break;
+                case 1: length = rand() % (length + 1); break;
+                default: if (length < (int)sizeof(data)) data[length++] = rand() % (MSG_TYPES + 1); break;
+                }
+            }
+        }
+
+        uint8_t* exact = (uint8_t*)malloc(length ? length : 1);
+        memcpy(exact, data, length);
+        if (decodeFrame(exact, length, out))
+        {
+            uint8_t again[FRAME_MAX_LENGTH];
+            ++accepted;
+            if (encodeFrame(out, again) != length || memcmp(again, exact, length)) ++mismatched;
+        }
+        free(exact);
+    }
+    printf("fuzz: %d inputs, %d decoded, %d not canonical\n", rounds, accepted, mismatched);
+
+    // What the link carries. One controller frame every 20 ms, each answered
+    // by one telemetry frame; feet and the rest alternate.
+    int word = controllerFrame(0, data);
+    int feet = frameLength(1<<MSG_FEET);
+    int rest = frameLength((1<<MSG_STABILITY) | (1<<MSG_TIMING));
+    printf("frame                  bytes   air us   fields\n");
+    printf("old controller word    %5d   %6.1f   1\n", 4, airTime(4));
+    printf("controller             %5d   %6.1f   1\n", word, airTime(word));
+    printf("feet                   %5d   %6.1f   12\n", feet, airTime(feet));
+    printf("stability + timing     %5d   %6.1f   7\n", rest, airTime(rest));
+    printf("per 20 ms exchange: %.1f us on air (%.2f%% of the channel), %.1f telemetry fields\n",
+           airTime(word) + 0.5f*(airTime(feet) + airTime(rest)),
+           (airTime(word) + 0.5f*(airTime(feet) + airTime(rest))) / 200.0f, 0.5f*(12 + 7));
+
+    // Controller and robot over the simulated air
+    link_result_t link;
+    runLink(LINK_TURNAROUND, 0, 1000, link);
+    printf("link: %d exchanges, control errors %d, telemetry errors %d, lost on air %d\n",
+           link.exchanges, link.exchanges - link.control, link.exchanges - link.telemetry, link.lostOnAir);
+
+    printf("%s\n", (errors == 0 && mismatched == 0 && link.control == link.exchanges &&
+                    link.telemetry == link.exchanges && link.lostOnAir == 0) ? "PASS" : "FAIL");
+}
+
+
+
+static void benchLink()
+{
+    const radio_link_t modes[2] = { LINK_TURNAROUND, LINK_ACK_PAYLOAD };
+    const char* names[2] = { "turnaround", "ack payload" };
+    const int drops[2] = { 0, 5 };
+    bool pass = true;
+
+    printf("link          drop   control  telemetry  robot cyc  robot deaf us   sent  acked  lost  retries\n");
+    for (int m = 0; m < 2; ++m)
+    {
+        for (int d = 0; d < 2; ++d)
+        {
+            link_result_t r;
+            runLink(modes[m], drops[d], 1000, r);
+            printf("%-11s  %5s  %7.1f%%  %8.1f%%  %9.1f  %13.1f  %5u  %5u  %4u  %7u\n",
+                   names[m], drops[d] ? "1/5" : "none", 100.0f*r.control/r.exchanges, 100.0f*r.telemetry/r.exchanges,
+                   (float)r.robotCycles/r.exchanges, (float)r.robotDeafUs/r.exchanges,
+                   r.stats.sent, r.stats.acked, r.stats.lost, r.stats.retries);
+
+            // Every frame gets through a clean link either way, and the
+            // retries recover all of them on the lossy one with ACKs
+            if (!drops[d] || modes[m] == LINK_ACK_PAYLOAD)
+                pass = pass && r.control == r.exchanges && r.telemetry >= r.exchanges - 1;
+            if (modes[m] == LINK_ACK_PAYLOAD)
+                pass = pass && r.robotDeafUs == 0 && r.stats.acked == r.stats.sent;
+        }
+    }
+    printf("%s\n", pass ? "PASS" : "FAIL");
+}
+
+
+
+// Controller frames through to the servos, with the robot running the main
+// loop: radio work between ticks, and a latency report on an ACK for every
+// frame that reaches the servos. The controller adds its own transmit to ACK
+// time for the end to end figure.
+static void runLatency(int rate, StageHistogram& air, StageHistogram& endToEnd)
+{
+    LinkRig& rig = linkRig();
+    const uint64_t duration = 20000000;
+    const uint64_t tickUs = (uint64_t)(PERIOD*1000000.0f);
+    // A little off the nominal rate, so frames arrive all through the tick
+    const uint64_t frameUs = 1000000/rate + 37;
+
+    rig.air.dropEvery = 0;
+    rig.robot.reset(LINK_ACK_PAYLOAD);
+    rig.ctrl.reset(LINK_ACK_PAYLOAD);
+    setupLegs();
+    setupTransforms();
+
+    // Start from whatever frame the robot still holds from the last run
+    const radio_state_t& held = rig.robot.poll();
+    latencyTrace.tickStart(held.controllerFrame, held.controllerTime, rig.robot.time());
+    latencyTrace.reset();
+    air.clear();
+    endToEnd.clear();
+
+    uint64_t start = SimClock::now();
+    uint64_t nextFrame = start, nextTick = start;
+    int lastLoaded = -1, lastReported = -1;
+
+    while (SimClock::now() - start < duration)
+    {
+        uint64_t now = SimClock::now();
+
+        // Controller, walking forward
+        rig.ctrl.service();
+        radio_frame_t got;
+        while (!rig.ctrl.transmitting() && rig.ctrl.receive(got))
+        {
+            if (!(got.types & (1<<MSG_LATENCY)) || got.latencyFrame == lastReported) continue;
+            lastReported = got.latencyFrame;
+            uint32_t t = rig.ctrl.frameTime(got.latencyFrame);
+            if (!t) continue;
+            air.add(t);
+            endToEnd.add(t + got.latency);
+        }
+        if (now >= nextFrame && rig.ctrl.transmit(0x00009c00))
+            nextFrame += frameUs;
+
+        // Robot
+        rig.robot.service();
+        if (now >= nextTick)
+        {
+            nextTick += tickUs;
+            const radio_state_t& state = rig.robot.poll();
+            latencyTrace.tickStart(state.controllerFrame, state.controllerTime, rig.robot.time());
+            controlTick(state.controller);
+            if (gaitStatus.moved) latencyTrace.applied(gaitStatus.applyCycles);
+
+            if (latencyTrace.haveLast && latencyTrace.lastFrame != lastLoaded && !rig.robot.ackPending())
+            {
+                lastLoaded = latencyTrace.lastFrame;
+                radio_frame_t frame;
+                frame.seq = 0;
+                frame.types = 1<<MSG_LATENCY;
+                frame.latencyFrame = latencyTrace.lastFrame;
+                frame.latency = latencyTrace.lastLatency;
+                frame.latencyP99 = 0;
+                frame.latencyMax = 0;
+                rig.robot.setAckPayload(frame);
+            }
+        }
+
+        wait_us(10);
+    }
+}
+
+
+
+static void benchLatency()
+{
+    const int rates[3] = { 25, 50, 100 };
+    StageHistogram air, endToEnd;
+    bool pass = true;
+
+    printf("rate    queue p50/p99    tick p50/p99    robot p50/p99/max      air p50   end to end p50/p99/max  (us)\n");
+    for (int r = 0; r < 3; ++r)
+    {
+        runLatency(rates[r], air, endToEnd);
+        const StageHistogram* s = latencyTrace.stages;
+        printf("%3d Hz  %6lu %6lu   %6lu %6lu   %6lu %6lu %6lu   %6lu   %6lu %6lu %6lu\n", rates[r],
+               (unsigned long)s[LATENCY_QUEUE].percentile(0.5f), (unsigned long)s[LATENCY_QUEUE].percentile(0.99f),
+               (unsigned long)s[LATENCY_TICK].percentile(0.5f), (unsigned long)s[LATENCY_TICK].percentile(0.99f),
+               (unsigned long)s[LATENCY_ROBOT].percentile(0.5f), (unsigned long)s[LATENCY_ROBOT].percentile(0.99f),
+               (unsigned long)s[LATENCY_ROBOT].max, (unsigned long)air.percentile(0.5f),
+               (unsigned long)endToEnd.percentile(0.5f), (unsigned long)endToEnd.percentile(0.99f),
+               (unsigned long)endToEnd.max);
+
+        // Frames replaced by a newer one during a stall never reach the
+        // servos, the rest are traced through. None waits more than a tick
+        // for the loop to pick it up.
+        pass = pass && endToEnd.count > 0.6f*20*rates[r] && s[LATENCY_QUEUE].max <= PERIOD*1000000.0f + 20;
+    }
+    printf("%s\n", pass ? "PASS" : "FAIL");
+}
+
+
+
+// What a tick pays for the log, against formatting the same fields as text
+// the way the old terminal log did, and what the ring does when the file
+// falls behind
+static void benchLog()
+{
+    const int ticks = 100000;
+    char text[512];
+
+    setupLegs();
+    setupTransforms();
+    controlTick(0x00009c00);
+
+    StageHistogram binary, formatted;
+    binary.clear();
+    formatted.clear();
+    for (int i = 0; i < ticks; ++i)
+    {
+        uint32_t c0 = cycleCount();
+        dataLog.tick(i*5000, 5000, 100, 0x00009c00, i);
+        uint32_t c1 = cycleCount();
+        int n = snprintf(text, sizeof(text), "%f %f %f %f %f", gaitStatus.motion.c, gaitStatus.motion.s,
+                         gaitStatus.motion.x, gaitStatus.motion.y, PERIOD);
+        for (int j = 0; j < 4; ++j)
+        {
+            vector3 p = QMat[j]*leg[j]->getFootPosition();
+            n += snprintf(text + n, sizeof(text) - n, " %f %f %f %f", p.x, p.y, p.z, gaitStatus.stability[j]);
+        }
+        uint32_t c2 = cycleCount();
+        binary.add(c1 - c0);
+        formatted.add(c2 - c1);
+    }
+    printf("per tick        p50 cyc  p99 cyc  bytes\n");
+    printf("binary record  %8lu %8lu  %5d\n", (unsigned long)binary.percentile(0.5f),
+           (unsigned long)binary.percentile(0.99f), (int)sizeof(log_record_t));
+    printf("text           %8lu %8lu  %5d\n", (unsigned long)formatted.percentile(0.5f),
+           (unsigned long)formatted.percentile(0.99f), (int)strlen(text));
+
+    // A file that only gets one block written for every two filled keeps
+    // everything it was given, and drops the rest without blocking
+    dataLog.start("/dev/null");
+    dataLog.service();
+    uint32_t records0 = dataLog.records, dropped0 = dataLog.dropped;
+    for (int i = 0; i < 20000; ++i)
+    {
+        dataLog.tick(i*5000, 5000, 100, 0x00009c00, i);
+        if (i % (2*LOG_RECORDS) == 0) dataLog.service();
+    }
+    uint32_t kept = dataLog.records - records0;
+    uint32_t dropped = dataLog.dropped - dropped0;
+
+    // Stopping drains the ring a block per call, like writing does
+    dataLog.stop();
+    int calls = 0;
+    uint32_t written0 = dataLog.written, mostPerCall = 0;
+    while (dataLog.writing())
+    {
+        uint32_t before = dataLog.written;
+        dataLog.service();
+        mostPerCall = std::max(mostPerCall, dataLog.written - before);
+        ++calls;
+    }
+    printf("slow file: %lu records kept, %lu dropped, %lu blocks written\n",
+           (unsigned long)kept, (unsigned long)dropped, (unsigned long)dataLog.written);
+    printf("stop: %lu blocks over %d calls, at most %lu per call\n", (unsigned long)(dataLog.written - written0), calls,
+           (unsigned long)mostPerCall);
+    printf("%s\n", (kept + dropped == 20000 && dataLog.written*LOG_RECORDS >= kept && dropped > 0 && mostPerCall == 1) ? "PASS" : "FAIL");
+}
+
+
+
+// The "leg" command's output, the old way with snprintf and the new way
+static int legText(char* output, bool printf)
+{
+    if (printf)
+    {
+        char buf[4][64];
+        for (int i = 0; i < 4; ++i)
+            leg[i]->getPosition().print(buf[i], 64);
+        return snprintf(output, 256, "A = [%s]\nB = [%s]\nC = [%s]\nD = [%s]\n", buf[0], buf[1], buf[2], buf[3]);
+    }
+
+    TextLine line(output, 256);
+    for (int i = 0; i < 4; ++i)
+    {
+        vector3 p = leg[i]->getPosition();
+        line.put('A' + i).text(" = [").fixed(p.x, 4).put('\t').fixed(p.y, 4).put('\t').fixed(p.z, 4).text("]\n");
+    }
+    return line.length();
+}
+
+
+
+// The "prof" command's table and budget line, written one line at a time
+static int profText(char* output, bool printf, void (*write)(const char*, int))
+{
+    char line[256];
+    int total = 0;
+
+    for (int i = 0; i < PROFILE_STAGES; ++i)
+    {
+        const StageHistogram& h = profiler.stages[i];
+        int n;
+        if (printf)
+        {
+            n = snprintf(line, 256, "%-14s %8lu %8lu %8lu %8lu %8lu\n", Profiler::name((profile_stage_t)i),
+                         (unsigned long)h.count, (unsigned long)(h.count ? h.min : 0),
+                         (unsigned long)h.percentile(0.5f), (unsigned long)h.percentile(0.99f),
+                         (unsigned long)h.max);
+        }
+        else
+        {
+            n = profiler.print(line, 256, (profile_stage_t)i);
+        }
+        write(line, n);
+        total += n;
+    }
+
+    float b[6];
+    for (int i = 0; i < 3; ++i)
+    {
+        float period = i == 0 ? 0.005f : i == 1 ? 0.0025f : 0.002f;
+        b[2*i] = 100.0f*profiler.budget(period, false);
+        b[2*i + 1] = 100.0f*profiler.budget(period, true);
+    }
+    int n;
+    if (printf)
+    {
+        n = snprintf(line, 256, "budget p99/max: %.1f%%/%.1f%% @ 200 Hz, %.1f%%/%.1f%% @ 400 Hz, %.1f%%/%.1f%% @ 500 Hz\n",
+                     b[0], b[1], b[2], b[3], b[4], b[5]);
+    }
+    else
+    {
+        static const char* rates[] = { " @ 200 Hz", " @ 400 Hz", " @ 500 Hz\n" };
+        TextLine l(line, 256);
+        l.text("budget p99/max: ");
+        for (int i = 0; i < 3; ++i)
+        {
+            if (i) l.text(", ");
+            l.fixed(b[2*i], 1).text("%/").fixed(b[2*i + 1], 1).put('%').text(rates[i]);
+        }
+        n = l.length();
+    }
+    write(line, n);
+    strcpy(output, line);
+    return total + n;
+}
+
+
+
+// Writes the old way: synchronously, a character at a time, over a UART
+static Serial blockingUart(USBTX, USBRX);
+
+static void blockingWrite(const char* text, int length)
+{
+    for (int i = 0; i < length; ++i)
+        blockingUart.putc(text[i]);
+}
+
+static void queuedWrite(const char* text, int length)
+{
+    textOut.write(text, length);
+}
+
+static void discardWrite(const char*, int)
+{
+}
+
+
+
+// What a terminal command costs the loop with printf and a blocking write,
+// against the fixed point formatter and the terminal ring, and whether the
+// formatter and ring get the text out right
+static void benchTerminal()
+{
+    const int runs = 2000;
+    char output[256], expected[256];
+
+    setupLegs();
+    setupTransforms();
+    for (int i = 0; i < 200; ++i)
+        controlTick(0x00009c00);
+
+    // Formatter against printf on random values at every precision. Fixed
+    // point may round differently from printf's exact decimal value, but
+    // never by more than half a unit in the last place.
+    int bad = 0, checked = 0;
+    for (int i = 0; i < 200000; ++i)
+    {
+        int decimals = i % 7;
+        float v = (rand() / (float)RAND_MAX - 0.5f) * (i & 8 ? 2.0f : 2000.0f);
+        TextLine line(output, 64);
+        line.fixed(v, decimals);
+        double got = atof(output);
+        double unit = 1.0;
+        for (int d = 0; d < decimals; ++d)
+            unit *= 0.1;
+        if (fabs(got - v) > 0.5*unit + fabs(v)*2e-7) ++bad;
+
+        long n = rand() - RAND_MAX/2;
+        TextLine ints(output, 64);
+        ints.number(n, 12).put(' ').hex((uint32_t)n, 8);
+        snprintf(expected, 64, "%12ld %08lx", n, (unsigned long)(uint32_t)n);
+        if (strcmp(output, expected)) ++bad;
+        checked += 2;
+    }
+    const char* special[] = { "nan", "ovf", "0.0000", "-1.0000", "   3.142" };
+    float specialValue[] = { NAN, 1e12f, -0.00004f, -0.99996f, 3.14159f };
+    int specialWidth[] = { 0, 0, 0, 0, 8 };
+    int specialDecimals[] = { 4, 4, 4, 4, 3 };
+    for (int i = 0; i < 5; ++i)
+    {
+        TextLine line(output, 64);
+        line.fixed(specialValue[i], specialDecimals[i], specialWidth[i]);
+        if (strcmp(output, special[i])) ++bad;
+        ++checked;
+    }
+    TextLine shortLine(output, 8);
+    shortLine.text("truncated here");
+    if (strcmp(output, "truncat") || !shortLine.truncated) ++bad;
+    printf("formatter: %d of %d differ from printf\n", bad, checked);
+
+    // Cost per command on the host, formatting plus the write. The p99 stands
+    // in for the worst case, since the host's own interrupts land in the max.
+    // A blocking write also holds the loop for the time on the wire.
+    struct
+    {
+        const char* name;
+        bool printf;
+        void (*write)(const char*, int);
+    } ways[] =
+    {
+        { "printf, format only", true, &discardWrite },
+        { "fixed, format only", false, &discardWrite },
+        { "fixed + ring", false, &queuedWrite },
+    };
+
+    printf("per command              leg p50  leg p99  prof p50  prof p99  (cycles)\n");
+    for (int w = 0; w < 3; ++w)
+    {
+        StageHistogram legCost, profCost;
+        legCost.clear();
+        profCost.clear();
+        for (int i = 0; i < runs; ++i)
+        {
+            uint32_t c0 = cycleCount();
+            int n = legText(output, ways[w].printf);
+            ways[w].write(output, n);
+            uint32_t c1 = cycleCount();
+            profText(output, ways[w].printf, ways[w].write);
+            uint32_t c2 = cycleCount();
+            legCost.add(c1 - c0);
+            profCost.add(c2 - c1);
+
+            // Empty the ring as the main loop would between commands
+            while (textOut.space() < TEXTOUT_RING)
+            {
+                textOut.service();
+                wait_us(100);
+            }
+        }
+        printf("%-22s %9lu %8lu %9lu %9lu\n", ways[w].name,
+               (unsigned long)legCost.percentile(0.5f), (unsigned long)legCost.percentile(0.99f),
+               (unsigned long)profCost.percentile(0.5f), (unsigned long)profCost.percentile(0.99f));
+    }
+
+    int legLength = legText(output, false);
+    int profLength = profText(output, false, &discardWrite);
+    const int bauds[] = { 9600, 115200 };
+    for (int b = 0; b < 2; ++b)
+    {
+        blockingUart.baud(bauds[b]);
+        uint64_t t0 = SimClock::now();
+        blockingWrite(output, legLength);
+        uint64_t t1 = SimClock::now();
+        profText(output, true, &blockingWrite);
+        uint64_t t2 = SimClock::now();
+        wait_ms(100);
+        printf("blocking write at %6d baud holds the loop %7.2f ms for leg, %7.2f ms for prof\n",
+               bauds[b], (t1 - t0) * 0.001, (t2 - t1) * 0.001);
+    }
+    printf("%d characters for leg, %d for prof\n", legLength, profLength);
+
+    // The ring never waits, hands the UART exactly what was written, and
+    // drops whole lines when full
+    FILE* wire = tmpfile();
+    textOut.serial.output = wire;
+    textOut.serial.baud(9600);
+    uint32_t dropped0 = textOut.dropped;
+    std::string written;
+    uint64_t t0 = SimClock::now();
+    for (int i = 0; i < 40; ++i)
+    {
+        int n = legText(output, false);
+        if (textOut.write(output, n)) written.append(output, n);
+    }
+    textOut.service();
+    bool waited = SimClock::now() != t0;
+    uint32_t lost = textOut.dropped - dropped0;
+    while (textOut.space() < TEXTOUT_RING)
+    {
+        wait_us(100);
+        textOut.service();
+    }
+    double drain = (SimClock::now() - t0) * 0.000001;
+
+    std::string received(written.size(), 0);
+    rewind(wire);
+    size_t got = fread(&received[0], 1, received.size(), wire);
+    bool whole = got == written.size() && fgetc(wire) == EOF && received == written;
+    fclose(wire);
+    textOut.serial.output = NULL;
+
+    printf("ring: %d lines queued, %lu dropped whole, sent in %.2f s at 9600 baud, %s, %s\n",
+           (int)(written.size() / legLength), (unsigned long)lost, drain,
+           waited ? "waited" : "never waited", whole ? "intact" : "damaged");
+    printf("%s\n", (bad == 0 && !waited && lost > 0 && whole) ? "PASS" : "FAIL");
+}
+
+
+
+// Background work for the scheduler benchmark, taking virtual time the way
+// the real tasks take processor time: the radio a little on most calls, a
+// log block write now and then, and terminal output in short bursts
+static int schedLogBlocks, schedTextChunks, schedLongTicks;
+
+static bool schedRadio()
+{
+    wait_us(15);
+    return false;
+}
+
+static bool schedLog()
+{
+    if (!schedLogBlocks) return false;
+    --schedLogBlocks;
+    wait_us(900);
+    return schedLogBlocks > 0;
+}
+
+static bool schedTerminal()
+{
+    if (!schedTextChunks) return false;
+    --schedTextChunks;
+    wait_us(150);
+    return schedTextChunks > 0;
+}
+
+
+
+// Terminal output the old way, polling the UART until the ring is empty at
+// a microsecond a poll, and as terminalTask does it, one FIFO fill per
+// release
+static Scheduler* schedTextScheduler;
+static uint32_t schedTextRelease;
+
+static bool schedTextPolled()
+{
+    wait_us(1);
+    textOut.service();
+    return textOut.space() < TEXTOUT_RING;
+}
+
+static bool schedTextPaced()
+{
+    if (schedTextRelease == schedTextScheduler->ticks) return false;
+    schedTextRelease = schedTextScheduler->ticks;
+    textOut.service();
+    return false;
+}
+
+
+
+// Control tick of 1.2 ms, with one of 10.6 ms every so often, and the log
+// and terminal work it makes
+static void schedTick(int i)
+{
+    bool slow = i % 397 == 396;
+    wait_us(slow ? 10600 : 1200);
+    if (slow) ++schedLongTicks;
+    if (i % LOG_RECORDS == 0) ++schedLogBlocks;
+    if (i % 50 == 0) schedTextChunks += 8;
+}
+
+
+
+// The old fixed delay loop, which spins until a period has passed since the
+// last tick started, against fixed rate releases from the scheduler
+static void benchScheduler()
+{
+    const float seconds = 20.0f;
+    const uint32_t releases = (uint32_t)(seconds / PERIOD + 0.5f);
+
+    // Fixed delay. The spin and its polling cost a microsecond a turn.
+    schedLogBlocks = schedTextChunks = 0;
+    Timer deltaTimer;
+    StageHistogram period;
+    period.clear();
+    int ticks = 0;
+    uint64_t end = SimClock::now() + (uint64_t)(seconds * 1000000.0f);
+    deltaTimer.start();
+    while (SimClock::now() < end)
+    {
+        while (deltaTimer.read() < PERIOD)
+        {
+            schedRadio();
+            schedLog();
+            schedTerminal();
+            wait_us(1);
+        }
+        period.add(deltaTimer.read_us());
+        deltaTimer.reset();
+        schedTick(ticks++);
+    }
+    printf("fixed delay: %d ticks in %.0f s for %lu periods, period p50 %lu us, max %lu us, idle 0%%\n",
+           ticks, seconds, (unsigned long)releases, (unsigned long)period.percentile(0.5f),
+           (unsigned long)period.max);
+
+    // Fixed rate
+    Scheduler s;
+    schedLogBlocks = schedTextChunks = schedLongTicks = 0;
+    s.setTask(SCHED_RADIO, &schedRadio);
+    s.setTask(SCHED_LOG, &schedLog);
+    s.setTask(SCHED_TERMINAL, &schedTerminal);
+    s.start(PERIOD);
+    int run = 0;
+    while (true)
+    {
+        s.waitRelease();
+        if (s.ticks > releases) break;
+        schedTick(run++);
+        s.tickDone();
+    }
+
+    char buf[512];
+    s.print(buf, sizeof(buf));
+    printf("fixed rate:\n%s", buf);
+
+    // Every release is either served or counted as skipped, each long tick
+    // misses its deadline and costs one release, and nothing delays a tick
+    // by more than the longest background call
+    bool pass = run + s.overruns == releases && s.deadlineMisses == (uint32_t)schedLongTicks &&
+                s.overruns == (uint32_t)schedLongTicks && s.jitter.max <= 900 + 15 + 1 && ticks < run;
+    printf("%lu releases, %d ticks run, %d long ticks: %s\n", (unsigned long)releases, run, schedLongTicks,
+           pass ? "PASS" : "FAIL");
+
+    // A full terminal ring at 115200 baud, with 1.2 ms ticks. Polling keeps
+    // the processor awake until the ring is empty; pacing has to leave most
+    // of each period asleep and still empty the ring within a second.
+    textOut.serial.baud(115200);
+    float idle[2], drain[2];
+    for (int paced = 0; paced < 2; ++paced)
+    {
+        char line[64];
+        memset(line, 'x', sizeof(line));
+        while (textOut.write(line, sizeof(line)))
+        {
+        }
+
+        Scheduler t;
+        schedTextScheduler = &t;
+        schedTextRelease = 0;
+        t.setTask(SCHED_TERMINAL, paced ? &schedTextPaced : &schedTextPolled);
+        t.start(PERIOD);
+        uint64_t t0 = SimClock::now();
+        drain[paced] = 0.0f;
+        idle[paced] = 0.0f;
+        while (true)
+        {
+            t.waitRelease();
+            if (textOut.space() == TEXTOUT_RING)
+            {
+                float elapsed = (SimClock::now() - t0) * 0.000001f;
+                drain[paced] = elapsed;
+                idle[paced] = t.slept * 0.000001f / elapsed;
+                break;
+            }
+            if (SimClock::now() - t0 > 2000000) break;
+            wait_us(1200);
+            t.tickDone();
+        }
+    }
+    textOut.serial.baud(9600);
+    printf("full terminal ring at 115200 baud: polled empty in %.3f s, %.0f%% asleep, paced in %.3f s, %.0f%% asleep: %s\n",
+           drain[0], 100.0f * idle[0], drain[1], 100.0f * idle[1],
+           (drain[1] > 0.0f && drain[1] < 1.0f && idle[1] > 0.5f) ? "PASS" : "FAIL");
+}
+
+
+
+// Walks forward for a while at each control and planning rate, timing every
+// tick, to show what the planning rate saves and what the control rate costs
+static void benchRates()
+{
+    const float seconds = 60.0f;
+    const float rates[][2] = { { 200, 200 }, { 200, 100 }, { 200, 50 }, { 400, 100 }, { 500, 100 }, { 500, 50 }, { 500, 500 } };
+    const int configs = sizeof(rates)/sizeof(rates[0]);
+    float baseline = 0.0f;
+    bool pass = true;
+
+    printf("control  plan   plans  p50 without plan  p50 with  p99 tick  load     p99 budget  distance\n");
+    for (int c = 0; c < configs; ++c)
+    {
+        float period = 1.0f / rates[c][0];
+        int ticks = (int)(seconds * rates[c][0] + 0.5f);
+
+        setupLegs();
+        setPlanPeriod(1.0f / rates[c][1]);
+        setupTransforms();
+
+        StageHistogram fast, planned;
+        fast.clear();
+        planned.clear();
+        uint64_t total = 0;
+        rigid2 body;
+        for (int i = 0; i < ticks; ++i)
+        {
+            wait(period);
+            uint32_t c0 = cycleCount();
+            controlTick(0x00009c00, period);
+            uint32_t cycles = cycleCount() - c0;
+            total += cycles;
+            (gaitStatus.planned ? planned : fast).add(cycles);
+            body = body * gaitStatus.motion.inverse();
+        }
+
+        // Load is the share of the processor the ticks take on average, the
+        // budget the share of a period the p99 tick takes, both on this host
+        StageHistogram all = fast;
+        for (int b = 0; b < PROFILE_BINS; ++b)
+            all.bins[b] += planned.bins[b];
+        all.count += planned.count;
+        all.max = std::max(fast.max, planned.max);
+        all.min = std::min(fast.min, planned.min);
+        float load = (float)total / (seconds * cycleFrequency());
+        float budget = all.percentile(0.99f) / (period * cycleFrequency());
+        float distance = sqrt(body.x*body.x + body.y*body.y);
+        if (!c) baseline = distance;
+
+        printf("%4.0f Hz %4.0f Hz %6lu %17lu %9lu %9lu %6.3f%% %9.3f%%  %6.3f m\n", rates[c][0], rates[c][1],
+               (unsigned long)planned.count, (unsigned long)fast.percentile(0.5f), (unsigned long)planned.percentile(0.5f),
+               (unsigned long)all.percentile(0.99f), 100.0f*load, 100.0f*budget, distance);
+
+        // Plans come at the planning rate, and the walk covers the same ground
+        // whatever the rates, since the motion follows the time step
+        float expected = seconds * rates[c][1];
+        pass = pass && fabs(planned.count - expected) <= 0.01f*expected + 1 && fabs(distance - baseline) <= 0.03f*baseline;
+    }
+
+    setPlanPeriod(PLAN_PERIOD);
+    setupTransforms();
+    printf("%s\n", pass ? "PASS" : "FAIL");
+}
+
+
+
+// Walks each controller word under both footstep policies and compares the
+// sustained speed. Turning in place is measured by the angle turned. Body
+// motion while a planted foot is dragged well outside its step circle, which
+// a leg that can't lift makes happen, doesn't count as walking, and more than 1%
+// of ticks dragged fails the run.
+static void benchFootsteps()
+{
+    const float seconds = 120.0f;
+    const struct { uint32_t word; const char* name; } walks[] =
+    {
+        { 0x00009c00, "forward" },
+        { 0x0000009c, "sideways" },
+        { 0x00c09c00, "forward turning" },
+        { 0x00c00000, "turn" },
+        { 0x00009c9c, "diagonal" },
+    };
+    const int count = sizeof(walks)/sizeof(walks[0]);
+    const char* policies[2] = { "greedy", "lookahead" };
+    float speed[2][count];
+    bool pass = true;
+
+    const float slack = 0.02f;
+
+    printf("walk              policy      speed   turn rate  stalled  dragged  min stability  steps  low lifts\n");
+    for (int w = 0; w < count; ++w)
+    {
+        for (int p = 0; p < 2; ++p)
+        {
+            // Same stance for every run
+            setupLegs();
+            resetLegs();
+            setStepPolicy(p ? STEP_LOOKAHEAD : STEP_GREEDY);
+            setupTransforms();
+
+            rigid2 body;
+            float turned = 0.0f;
+            float minStability = 1.0f;
+            int ticks = (int)(seconds / PERIOD + 0.5f);
+            int stalled = 0, dragged = 0, steps = 0, lowLifts = 0;
+            bool wasStepping[4] = { false, false, false, false };
+            for (int i = 0; i < ticks; ++i)
+            {
+                wait(PERIOD);
+                controlTick(walks[w].word, PERIOD);
+                if (!gaitStatus.moved) ++stalled;
+
+                bool drag = false;
+                for (int j = 0; j < 4; ++j)
+                {
+                    vector3 q = leg[j]->getPosition();
+                    float dx = q.x - CIRCLE_X;
+                    float dy = q.y - CIRCLE_Y;
+                    if (!leg[j]->getStepping() && dx*dx + dy*dy > (CIRCLE_R + slack)*(CIRCLE_R + slack)) drag = true;
+                }
+                if (drag)
+                {
+                    ++dragged;
+                }
+                else
+                {
+                    rigid2 m = gaitStatus.motion.inverse();
+                    body = body * m;
+                    turned += atan2(m.s, m.c);
+                }
+
+                // Every lift has to leave the margin it is decided by above the
+                // minimum
+                for (int j = 0; j < 4; ++j)
+                {
+                    bool s = leg[j]->getStepping();
+                    if (s && !wasStepping[j])
+                    {
+                        ++steps;
+                        if (gaitStatus.diagonal[j] <= BORDER_MIN) ++lowLifts;
+                    }
+                    wasStepping[j] = s;
+                    if (gaitStatus.stability[j] < minStability) minStability = gaitStatus.stability[j];
+                }
+            }
+
+            speed[p][w] = sqrt(body.x*body.x + body.y*body.y) / seconds;
+            printf("%-17s %-9s %6.3f m/s %6.1f d/s %7.1f%% %7.1f%% %12.4f m %6d %10d\n", walks[w].name, policies[p], speed[p][w],
+                   turned * 57.2958f / seconds, 100.0f * stalled / ticks, 100.0f * dragged / ticks, minStability, steps, lowLifts);
+            pass = pass && !lowLifts && dragged < 0.01f*ticks;
+        }
+    }
+
+    // The lookahead has to be faster walking straight, where the greedy
+    // policy stops the body for every step
+    pass = pass && speed[1][0] > 1.1f*speed[0][0] && speed[1][1] > 1.1f*speed[0][1];
+
+    setStepPolicy(STEP_LOOKAHEAD);
+    setupTransforms();
+    printf("%s\n", pass ? "PASS" : "FAIL");
+}
+
+
+
+// Walks each gait mode straight, sideways and turning on the spot, and
+// measures the speed, how much of the time two legs swing together, and the
+// margins every lift was made with: the static support margin for a leg
+// lifted alone, and what is left of DYNAMIC_MARGIN for a pair
+static void benchGaits()
+{
+    const float seconds = 120.0f;
+    const uint32_t walks[3] = { 0x00009c00, 0x0000009c, 0x00c00000 };
+    float speed[GAIT_MODES];
+    bool pass = true;
+
+    printf("mode   forward   sideways  turn       stalled  overlap  lifts  pairs  min static  min dynamic  low\n");
+    for (int m = 0; m < GAIT_MODES; ++m)
+    {
+        float result[3];
+        int ticks = (int)(seconds / PERIOD + 0.5f);
+        int stalled = 0, overlap = 0, lifts = 0, pairs = 0, low = 0;
+        float minStatic = 1.0f, minDynamic = 1.0f;
+
+        for (int w = 0; w < 3; ++w)
+        {
+            setupLegs();
+            resetLegs();
+            setGaitMode((gait_mode_t)m);
+            setupTransforms();
+
+            rigid2 body;
+            float turned = 0.0f;
+            bool wasStepping[4] = { false, false, false, false };
+            for (int i = 0; i < ticks; ++i)
+            {
+                wait(PERIOD);
+                controlTick(walks[w], PERIOD);
+                rigid2 motion = gaitStatus.motion.inverse();
+                body = body * motion;
+                turned += atan2(motion.s, motion.c);
+                if (!gaitStatus.moved) ++stalled;
+
+                // A partner waiting for its phase counts as stepping from the
+                // tick the pair was lifted
+                int swinging = 0, lifted = 0, leader = 0;
+                for (int j = 0; j < 4; ++j)
+                {
+                    bool s = leg[j]->getStepping();
+                    if (s && !wasStepping[j])
+                    {
+                        ++lifted;
+                        leader = j;
+                    }
+                    swinging += s && leg[j]->getFootPosition().z > CIRCLE_Z + 0.001f;
+                    wasStepping[j] = s;
+                }
+                if (swinging > 1) ++overlap;
+                if (lifted == 1)
+                {
+                    ++lifts;
+                    minStatic = std::min(minStatic, gaitStatus.diagonal[leader]);
+                    if (gaitStatus.diagonal[leader] <= BORDER_MIN) ++low;
+                }
+                else if (lifted == 2)
+                {
+                    ++pairs;
+                    minDynamic = std::min(minDynamic, gaitStatus.pairMargin);
+                    if (gaitStatus.pairMargin <= 0.0f) ++low;
+                }
+            }
+
+            result[w] = w < 2 ? sqrt(body.x*body.x + body.y*body.y) / seconds : turned * 57.2958f / seconds;
+        }
+
+        speed[m] = result[0];
+        printf("%-6s %5.3f m/s %5.3f m/s %5.1f d/s %7.1f%% %7.1f%% %6d %6d %9.4f m %10.4f m %4d\n", gaitModeName((gait_mode_t)m),
+               result[0], result[1], fabs(result[2]), 100.0f * stalled / (3*ticks), 100.0f * overlap / (3*ticks), lifts, pairs,
+               lifts ? minStatic : 0.0f, pairs ? minDynamic : 0.0f, low);
+        pass = pass && !low && stalled < 0.01f*3*ticks && (m == GAIT_CRAWL || pairs);
+    }
+
+    // Each mode has to be well clear of the one before it
+    pass = pass && speed[GAIT_AMBLE] > 1.3f*speed[GAIT_CRAWL] && speed[GAIT_TROT] > 1.3f*speed[GAIT_AMBLE];
+
+    setGaitMode(GAIT_CRAWL);
+    setupTransforms();
+    printf("%s\n", pass ? "PASS" : "FAIL");
+}
+
+
+
+// Stands in for the radio interrupt: pushes numbered packets as fast as it
+// can, retrying when the queue is full so every slot changes hands many times
+static SPSCQueue<radio_packet_t, RX_QUEUE_SIZE> stressQueue;
+static const uint32_t stressPackets = 2000000;
+static volatile bool stressDone;
+
+static void* stressProducer(void*)
+{
+    for (uint32_t i = 0; i < stressPackets; ++i)
+    {
+        radio_packet_t p;
+        p.seq = (uint16_t)i;
+        p.time = i;
+        p.length = i % (FRAME_MAX_LENGTH + 1);
+        p.pipe = i & 1;
+        for (int k = 0; k < FRAME_MAX_LENGTH; ++k)
+            p.data[k] = (uint8_t)(i*2654435761u >> (k & 24)) + k;
+        // Let the consumer run if it is on the same core
+        while (!stressQueue.push(p)) sched_yield();
+    }
+    stressDone = true;
+    return NULL;
+}
+
+
+
+static void benchQueue()
+{
+    pthread_t producer;
+    radio_packet_t p;
+    uint32_t popped = 0, torn = 0, reordered = 0;
+    uint32_t last = 0;
+    bool first = true;
+
+    stressDone = false;
+    uint32_t c0 = cycleCount();
+    pthread_create(&producer, NULL, &stressProducer, NULL);
+
+    // The main loop side, checking every packet arrives whole and in order
+    while (!stressDone || stressQueue.count())
+    {
+        while (stressQueue.pop(p))
+        {
+            bool whole = p.seq == (uint16_t)p.time && p.pipe == (p.time & 1) && p.length == p.time % (FRAME_MAX_LENGTH + 1);
+            for (int k = 0; k < FRAME_MAX_LENGTH; ++k)
+                whole = whole && p.data[k] == (uint8_t)((uint8_t)(p.time*2654435761u >> (k & 24)) + k);
+            if (!whole) ++torn;
+            if (!first && p.time <= last) ++reordered;
+            last = p.time;
+            first = false;
+            ++popped;
+        }
+        sched_yield();
+    }
+
+    pthread_join(producer, NULL);
+    float seconds = (float)(cycleCount() - c0) / cycleFrequency();
+    uint32_t overruns = stressQueue.overruns;
+
+    printf("%lu packets from a second thread in %.2f s (%.1f M/s), queue of %d\n",
+           (unsigned long)stressPackets, seconds, stressPackets / seconds * 1e-6f, RX_QUEUE_SIZE);
+    printf("received %lu, full queue retries %lu, torn %lu, out of order %lu: %s\n",
+           (unsigned long)popped, (unsigned long)overruns, (unsigned long)torn, (unsigned long)reordered,
+           (popped == stressPackets && torn == 0 && reordered == 0) ? "PASS" : "FAIL");
+}
+
+
+
+// The swing path RobotLeg::update took before SwingProfile
+static vector3 cosineSwing(const vector3& a, const vector3& b, float height, float stepTime, float t)
+{
+    float delta = 3.141593f / stepTime;
+    float s = sinf(delta*t);
+    float c = cosf(delta*t);
+    return vector3(a.x + (b.x - a.x)*0.5f*(1 - c), a.y + (b.y - a.y)*0.5f*(1 - c),
+                   a.z + (b.z - a.z)*delta*t + height*s);
+}
+
+
+
+static void benchSwing()
+{
+    const int n = 1 << 16;
+    const float stride = 0.144f;    // Across the step circle, 0.8 of its radius either side
+    const float height = 0.05f;
+    static float ts[n];
+    float cosineCycles, profileCycles;
+
+    // Swing times from the crawl down to twice the trot's step frequency
+    const float times[] = { 0.4f, 0.2f, 0.1f };
+    vector3 a(0.095f - 0.072f, 0.095f, -0.12f);
+    vector3 b(0.095f + 0.072f, 0.095f, -0.12f);
+    SwingProfile swing;
+    swing.setStepHeight(height);
+
+    printf("step s   cosine cyc   profile cyc   max err %%   landing m/s cosine   profile   peak m/s cosine   profile\n");
+    bool pass = true;
+    for (int k = 0; k < 3; ++k)
+    {
+        float T = times[k];
+        swing.setStepTime(T);
+        srand(1);
+        for (int i = 0; i < n; ++i) ts[i] = (rand() / (float)RAND_MAX) * T;
+
+        TIME_CALLS(cosineCycles, n, cosineSwing(a, b, height, T, ts[i]).z);
+        TIME_CALLS(profileCycles, n, swing.position(a, b, ts[i]).z);
+
+        // Against the exact polynomials, relative to the stride and height
+        double err = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            double u = ts[i] / T;
+            double g = u*u*u*(10.0 + u*(-15.0 + u*6.0));
+            double l = 64.0*u*u*u*(1.0 - u)*(1.0 - u)*(1.0 - u);
+            vector3 p = swing.position(a, b, ts[i]);
+            err = fmax(err, fabs(p.x - (a.x + (b.x - a.x)*g)) / stride);
+            err = fmax(err, fabs(p.z - (a.z + height*l)) / height);
+        }
+
+        // Foot speed over the last millisecond, and the fastest on the way
+        float dt = 0.001f;
+        vector3 cosineLand = cosineSwing(a, b, height, T, T) - cosineSwing(a, b, height, T, T - dt);
+        vector3 profileLand = swing.position(a, b, T) - swing.position(a, b, T - dt);
+        float cosinePeak = 0.0f, profilePeak = 0.0f;
+        for (float t = 0.0f; t < T; t += dt)
+        {
+            cosinePeak = fmax(cosinePeak, (cosineSwing(a, b, height, T, t + dt) - cosineSwing(a, b, height, T, t)).norm() / dt);
+            profilePeak = fmax(profilePeak, (swing.position(a, b, t + dt) - swing.position(a, b, t)).norm() / dt);
+        }
+
+        printf("%-6.2f   %10.1f   %11.1f   %10.4f   %18.3f   %7.3f   %15.3f   %7.3f\n",
+               T, cosineCycles, profileCycles, err*100.0, cosineLand.norm()/dt, profileLand.norm()/dt,
+               cosinePeak, profilePeak);
+
+        if (profileCycles > cosineCycles || err > 0.001 || profileLand.norm() > 0.05f*cosineLand.norm()) pass = false;
+    }
+
+    printf("profile no slower than the cosine path, within 0.1%% of stride and height, landing under 5%% as fast: %s\n",
+           pass ? "PASS" : "FAIL");
+}
+
+
+
+// Stability as it was before SupportPolygon: each foot moved into robot
+// coordinates every plan, and one support line per leg through two others
+static void lineMargins(float* out)
+{
+    const int line1[4] = { 2, 3, 1, 0 };
+    const int line2[4] = { 3, 2, 0, 1 };
+    vector3 p[4];
+
+    for (int i = 0; i < 4; ++i)
+        p[i] = QMat[i]*leg[i]->getPosition();
+    for (int i = 0; i < 4; ++i)
+    {
+        const vector3& a = p[line1[i]];
+        const vector3& b = p[line2[i]];
+        float lx = b.x - a.x;
+        float ly = b.y - a.y;
+        out[i] = (ly*(-a.x) - lx*(-a.y)) / sqrtf(lx*lx + ly*ly);
+    }
+}
+
+
+
+// Walks each gait diagonally while turning and checks the margins kept up
+// incrementally against a polygon built from scratch every tick, then times
+// a plan's stability both ways
+static void benchSupport()
+{
+    const float seconds = 60.0f;
+    bool pass = true;
+
+    printf("mode   ticks   max diff m   outer edge   min lift m   min swing m   line cyc   polygon cyc\n");
+    for (int m = 0; m < GAIT_MODES; ++m)
+    {
+        setupLegs();
+        resetLegs();
+        setGaitMode((gait_mode_t)m);
+        setupTransforms();
+
+        int ticks = (int)(seconds / PERIOD + 0.5f);
+        int checked = 0, outer = 0;
+        float maxDiff = 0.0f, minLift = 1.0f, minSwing = 1.0f;
+        uint32_t lineCycles = 0, polygonCycles = 0;
+        for (int i = 0; i < ticks; ++i)
+        {
+            float ref[4], line[4], out[4];
+            SupportPolygon fresh;
+            for (int j = 0; j < 4; ++j)
+            {
+                vector3 p = QMat[j]*leg[j]->getPosition();
+                if (leg[j]->getStepping()) fresh.lift(j, p);
+                else fresh.setFoot(j, p);
+            }
+            fresh.liftMargins(ref);
+            float refMargin = fresh.margin();
+
+            uint32_t c0 = cycleCount();
+            lineMargins(line);
+            uint32_t c1 = cycleCount();
+            support.liftMargins(out);
+            sink += support.margin() + out[0];
+            uint32_t c2 = cycleCount();
+            lineCycles += c1 - c0;
+            polygonCycles += c2 - c1;
+
+            wait(PERIOD);
+            controlTick(0x00c09c64, PERIOD);
+            if (!gaitStatus.planned) continue;
+
+            ++checked;
+            maxDiff = std::max(maxDiff, (float)fabs(gaitStatus.margin - refMargin));
+            for (int j = 0; j < 4; ++j)
+            {
+                maxDiff = std::max(maxDiff, (float)fabs(gaitStatus.stability[j] - ref[j]));
+                if (ref[j] < line[j] - 0.0001f) ++outer;
+                minLift = std::min(minLift, gaitStatus.stability[j]);
+            }
+            minSwing = std::min(minSwing, gaitStatus.margin);
+        }
+
+        printf("%-6s %6d   %10.6f   %10d   %10.4f   %11.4f   %8.1f   %11.1f\n", gaitModeName((gait_mode_t)m), checked,
+               maxDiff, outer, minLift, minSwing, (float)lineCycles / ticks, (float)polygonCycles / ticks);
+        pass = pass && checked == ticks && maxDiff < 0.0001f;
+    }
+
+    setGaitMode(GAIT_CRAWL);
+    setupTransforms();
+    printf("incremental margins within 0.1 mm of a rebuilt polygon: %s\n", pass ? "PASS" : "FAIL");
+}
+
+
+
+// Walks forward, sideways, diagonally and diagonally while turning under both
+// footstep policies with the body sway off and on, and measures the time
+// stalled per metre walked as the simulator does: a tick is stalled if the
+// commanded motion was not applied or a planted foot is dragged well outside
+// its circle, and dragged ticks don't count as walking
+static void benchSway()
+{
+    const float seconds = 120.0f;
+    const float slack = 0.02f;
+    const uint32_t walks[] = { 0x00009c00, 0x0000009c, 0x00009c9c, 0x00c09c64 };
+    const char* names[] = { "forward", "sideways", "diagonal", "diagonal turning" };
+    const char* policies[2] = { "greedy", "lookahead" };
+    float perMetre[2] = { 0.0f, 0.0f };
+    int draggedOn = 0, ticksOn = 0;
+
+    printf("walk              policy      sway  walked    stalled  s per m  dragged\n");
+    for (int w = 0; w < 4; ++w)
+    {
+        for (int p = 0; p < 2; ++p)
+        {
+            for (int on = 0; on < 2; ++on)
+            {
+                setupLegs();
+                resetLegs();
+                setStepPolicy(p ? STEP_LOOKAHEAD : STEP_GREEDY);
+                setBodySway(on != 0);
+                setupTransforms();
+
+                rigid2 walked;
+                int ticks = (int)(seconds / PERIOD + 0.5f);
+                int stalled = 0, dragged = 0;
+                for (int i = 0; i < ticks; ++i)
+                {
+                    wait(PERIOD);
+                    controlTick(walks[w], PERIOD);
+
+                    bool drag = false;
+                    for (int j = 0; j < 4; ++j)
+                    {
+                        vector3 q = leg[j]->getPosition();
+                        float dx = q.x - CIRCLE_X;
+                        float dy = q.y - CIRCLE_Y;
+                        if (!leg[j]->getStepping() && dx*dx + dy*dy > (CIRCLE_R + slack)*(CIRCLE_R + slack)) drag = true;
+                    }
+                    if (drag) ++dragged;
+                    else walked = walked * gaitStatus.motion.inverse();
+                    if (drag || !gaitStatus.moved) ++stalled;
+                }
+
+                float distance = sqrt(walked.x*walked.x + walked.y*walked.y);
+                float time = stalled * PERIOD;
+                float rate = time / (distance > 0.1f ? distance : 0.1f);
+                if (w < 3) perMetre[on] += rate;
+                if (on)
+                {
+                    draggedOn += dragged;
+                    ticksOn += ticks;
+                }
+                printf("%-17s %-9s %5s %6.2f m %7.1f s %8.2f %7.1f%%\n", names[w], policies[p], on ? "on" : "off",
+                       distance, time, rate, 100.0f * dragged / ticks);
+            }
+        }
+    }
+
+    // Turning on the spot hardly walks, so only the straight walks are summed
+    setBodySway(true);
+    setStepPolicy(STEP_LOOKAHEAD);
+    setupTransforms();
+    float draggedShare = 100.0f * draggedOn / ticksOn;
+    printf("straight walks stalled %.2f s per m with sway, %.2f without, dragged %.2f%% of ticks with sway: %s\n",
+           perMetre[1], perMetre[0], draggedShare, (perMetre[1] < 0.5f*perMetre[0] && draggedShare < 1.0f) ? "PASS" : "FAIL");
+}
+
+
+
+struct benchmark_t
+{
+    const char* name;
+    const char* description;
+    void (*run)();
+};
+
+static const benchmark_t benchmarks[] =
+{
+    { "loop", "Per-stage cycle counts of the control tick", &benchLoop },
+    { "trig", "Approximate trig against libm", &benchTrig },
+    { "ik", "Batched four leg kinematics against one leg at a time", &benchIK },
+    { "geometry", "Compile time leg geometry against the runtime dimensions", &benchGeometry },
+    { "reach", "Reachability map lookup against solving the IK", &benchReach },
+    { "inverse", "Rigid transform inverse against the general inverse", &benchInverse },
+    { "matrix", "Header only matrix code against the old out of line code", &benchMatrix },
+    { "radio", "Deferred radio driver against the register model", &benchRadio },
+    { "queue", "Packet queue hammered from a second thread", &benchQueue },
+    { "protocol", "Frame encoder and decoder, fuzzed and over a simulated link", &benchProtocol },
+    { "link", "Telemetry on ACK payloads against switching the robot to PTX", &benchLink },
+    { "latency", "Controller frame to servo write latency through the main loop", &benchLatency },
+    { "log", "Binary tick log against text formatting, and a file that falls behind", &benchLog },
+    { "rates", "Control tick cost and walking distance at several control and planning rates", &benchRates },
+    { "scheduler", "Fixed rate releases against the fixed delay loop, on the virtual clock", &benchScheduler },
+    { "terminal", "Command output through the terminal ring against printf and blocking writes", &benchTerminal },
+    { "footsteps", "Lookahead footstep planner against the greedy step policy, in body speed", &benchFootsteps },
+    { "gaits", "Speed and stability margins of the crawl, amble and trot", &benchGaits },
+    { "swing", "Swing profile lookup against the cosine path, in cycles and smoothness", &benchSwing },
+    { "support", "Incremental support polygon against rebuilding it, in margins and cycles", &benchSupport },
+    { "sway", "Time stalled per metre walked with the body sway off and on", &benchSway },
+};
+
+static const int benchmarkCount = sizeof(benchmarks)/sizeof(benchmarks[0]);
+
+
+
+int main(int argc, char** argv)
+{
+    cycleCounterStart();
+
+    for (int i = 0; i < benchmarkCount; ++i)
+    {
+        bool selected = (argc < 2);
+        for (int j = 1; j < argc; ++j)
+            if (!strcmp(argv[j], benchmarks[i].name)) selected = true;
+
+        if (selected)
+        {
+            printf("== %s: %s\n", benchmarks[i].name, benchmarks[i].description);
+            benchmarks[i].run();
+            printf("\n");
+        }
+    }
+
+    return 0;
+}
+
+#endif // HAL_POSIX
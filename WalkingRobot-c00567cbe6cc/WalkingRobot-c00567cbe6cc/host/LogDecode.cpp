@@ -0,0 +1,173 @@
+// Tick log decoder
+//
+// Turns a binary log from "log start" or Simulator -l, or the text of a
+// "log dump" captured from the terminal, into CSV with one row per tick.
+// Lengths are in metres and times in seconds. Missing blocks and damaged
+// ones are reported on stderr and skipped.
+//
+// -e also writes the step events, lift and land per leg, in the same format
+// as the simulator's.
+//
+// usage: LogDecode [-o ticks.csv] [-e events.csv] log.bin|dump.txt
+
+#ifdef HAL_POSIX
+
+#include "DataLog.h"
+#include "RadioProtocol.h"
+#include <vector>
+#include <cctype>
+
+
+
+// Binary blocks as they are, or hex lines from a dump with anything else on
+// the terminal in between ignored
+static bool loadLog(const char* filename, std::vector<uint8_t>& data)
+{
+    FILE* f = fopen(filename, "rb");
+    if (!f) return false;
+
+    uint32_t magic = 0;
+    bool binary = fread(&magic, 4, 1, f) == 1 && magic == LOG_MAGIC;
+    rewind(f);
+
+    if (binary)
+    {
+        uint8_t buf[LOG_BLOCK_SIZE];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            data.insert(data.end(), buf, buf + n);
+    }
+    else
+    {
+        char line[512];
+        while (fgets(line, sizeof(line), f))
+        {
+            int length = strlen(line);
+            while (length && isspace((unsigned char)line[length - 1])) --length;
+            if (!length || length % 2) continue;
+
+            bool hex = true;
+            for (int i = 0; i < length && hex; ++i)
+                hex = isxdigit((unsigned char)line[i]);
+            if (!hex) continue;
+
+            for (int i = 0; i < length; i += 2)
+            {
+                unsigned int byte;
+                sscanf(line + i, "%2x", &byte);
+                data.push_back(byte);
+            }
+        }
+    }
+
+    fclose(f);
+    return true;
+}
+
+
+
+int main(int argc, char** argv)
+{
+    const char* input = NULL;
+    const char* ticksFile = NULL;
+    const char* eventsFile = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) ticksFile = argv[++i];
+        else if (!strcmp(argv[i], "-e") && i + 1 < argc) eventsFile = argv[++i];
+        else if (argv[i][0] != '-' && !input) input = argv[i];
+        else
+        {
+            fprintf(stderr, "usage: %s [-o ticks.csv] [-e events.csv] log.bin|dump.txt\n", argv[0]);
+            return 1;
+        }
+    }
+    if (!input)
+    {
+        fprintf(stderr, "usage: %s [-o ticks.csv] [-e events.csv] log.bin|dump.txt\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<uint8_t> data;
+    if (!loadLog(input, data))
+    {
+        fprintf(stderr, "Cannot read %s\n", input);
+        return 1;
+    }
+
+    FILE* ticks = ticksFile ? fopen(ticksFile, "w") : stdout;
+    FILE* events = eventsFile ? fopen(eventsFile, "w") : NULL;
+    if (!ticks || (eventsFile && !events))
+    {
+        fprintf(stderr, "Cannot write output\n");
+        return 1;
+    }
+
+    fprintf(ticks, "t,period,tick,controller,frame,moved,c,s,x,y");
+    for (int i = 0; i < 4; ++i)
+        fprintf(ticks, ",x%d,y%d,z%d,stability%d,stepping%d", i, i, i, i, i);
+    fprintf(ticks, "\n");
+    if (events) fprintf(events, "t,leg,event,x,y,z\n");
+
+    const float m = 1.0f / FRAME_UNITS_PER_M;
+    unsigned long blocks = 0, records = 0, bad = 0, missing = 0;
+    uint32_t first = 0;
+    int lastSeq = -1;
+    uint8_t lastFlags = 0;
+
+    for (size_t pos = 0; pos + LOG_BLOCK_SIZE <= data.size(); pos += LOG_BLOCK_SIZE)
+    {
+        log_block_t b;
+        memcpy(&b, &data[pos], LOG_BLOCK_SIZE);
+        if (b.magic != LOG_MAGIC || b.version != LOG_VERSION || b.count > LOG_RECORDS)
+        {
+            ++bad;
+            continue;
+        }
+
+        if (lastSeq >= 0 && b.seq != (uint16_t)(lastSeq + 1))
+        {
+            int gap = (uint16_t)(b.seq - lastSeq - 1);
+            fprintf(stderr, "%d blocks missing before block %u\n", gap, b.seq);
+            missing += gap;
+        }
+        lastSeq = b.seq;
+        ++blocks;
+
+        for (int r = 0; r < b.count; ++r)
+        {
+            const log_record_t& l = b.records[r];
+            if (!records) first = l.time;
+
+            // Time from the first tick, across the radio clock wrapping
+            double t = (uint32_t)(l.time - first) * 0.000001;
+            fprintf(ticks, "%.6f,%u,%u,%08lx,%u,%d,%.5f,%.5f,%.5f,%.5f", t, l.period, l.tick,
+                    (unsigned long)l.controller, l.frame, (l.flags & LOG_MOVED) ? 1 : 0,
+                    l.motion[0] / LOG_UNIT_ROTATION, l.motion[1] / LOG_UNIT_ROTATION, l.motion[2] * m, l.motion[3] * m);
+            for (int i = 0; i < 4; ++i)
+            {
+                fprintf(ticks, ",%.4f,%.4f,%.4f,%.4f,%d", l.feet[i][0] * m, l.feet[i][1] * m, l.feet[i][2] * m,
+                        l.stability[i] * m, (l.flags & LOG_STEPPING(i)) ? 1 : 0);
+
+                bool s = l.flags & LOG_STEPPING(i);
+                if (events && records && s != (bool)(lastFlags & LOG_STEPPING(i)))
+                    fprintf(events, "%.3f,%d,%s,%.4f,%.4f,%.4f\n", t, i, s ? "lift" : "land",
+                            l.feet[i][0] * m, l.feet[i][1] * m, l.feet[i][2] * m);
+            }
+            fprintf(ticks, "\n");
+
+            lastFlags = l.flags;
+            ++records;
+        }
+    }
+
+    fprintf(stderr, "%lu records in %lu blocks, %lu damaged, %lu missing\n", records, blocks, bad, missing);
+
+    if (ticksFile) fclose(ticks);
+    if (events) fclose(events);
+
+    return 0;
+}
+
+#endif // HAL_POSIX
@@ -0,0 +1,349 @@
+// Arena radio simulator
+//
+// Runs N controller/robot pairs on one simulated medium, with the real Radio
+// and RadioController drivers over nRF24L01+ register models, and counts the
+// control and telemetry frames that get through and how late. Packets that
+// overlap on a channel collide: the one that started first is captured and
+// the later one is lost. ACKs take air time like any other packet.
+//
+// Every run is done three ways:
+//
+//   single  all pairs on RF_CHANNEL, each controller free running at 50 Hz
+//   tdma    arena schedule, controllers on a common clock sending in their slots
+//   hop     arena schedule, controllers free running, so only the hop
+//           sequences keep the pairs apart
+//
+// Free running controllers start at a random phase and drift by up to
+// 100 ppm. Telemetry rides on the ACKs, as on the robot.
+//
+// usage: RadioArena [-n pairs] [-t seconds] [-s seed]
+
+#ifdef HAL_POSIX
+
+#include "Radio.h"
+#include "nRF24L01P_sim.h"
+#include "nRF24L01P_defs.h"
+#include <vector>
+#include <algorithm>
+
+// Drivers are polled this often, like a main loop with nothing else to do
+#define ARENA_STEP_US 20
+
+// All radios share one SPI bus, and the rest of their pins are made up
+#define ARENA_SCK ((PinName)64)
+#define ARENA_PIN(n) ((PinName)(65 + (n)))
+
+enum arena_mode_t
+{
+    ARENA_SINGLE,
+    ARENA_TDMA,
+    ARENA_HOP
+};
+
+static const char* modeNames[] = { "single", "tdma", "hop" };
+
+
+
+// Microseconds on air at 2 Mbps: preamble, address, packet control, payload
+// and CRC
+static int onAir(int addressWidth, int length)
+{
+    return ((1 + addressWidth + length + 1)*8 + 9) / 2;
+}
+
+
+
+// Shared medium. Keeps what was on air in the last few milliseconds to find
+// collisions, and hands every other packet to all the radios.
+class ArenaAir : public SimAir
+{
+public:
+    ArenaAir() : collisions(0) {}
+
+    virtual bool transmitted(nRF24L01P_sim* from, int channel, const uint8_t* address, int addressWidth,
+                             const uint8_t* data, int length, uint8_t* ack, int* ackLength)
+    {
+        uint64_t now = SimClock::now();
+        *ackLength = -1;
+
+        // Packets are only seen once they have been sent, so the packet that
+        // started first wins
+        if (busy(channel, now - onAir(addressWidth, length), now))
+        {
+            ++collisions;
+            return false;
+        }
+        add(channel, now - onAir(addressWidth, length), now);
+
+        bool acked = false;
+        for (size_t i = 0; i < radios.size(); ++i)
+        {
+            uint8_t buf[SIM_MAX_PAYLOAD];
+            int n;
+            if (radios[i] == from) continue;
+            if (!radios[i]->receivePacket(channel, address, addressWidth, data, length, buf, &n) || n < 0 || acked) continue;
+
+            acked = true;
+            memcpy(ack, buf, n);
+            *ackLength = n;
+        }
+        if (!acked) return false;
+
+        // The ACK goes out once the receiver has turned around
+        uint64_t ackStart = now + TIMING_Tstby2a;
+        uint64_t ackEnd = ackStart + onAir(addressWidth, *ackLength);
+        if (busy(channel, ackStart, ackEnd))
+        {
+            ++collisions;
+            return false;
+        }
+        add(channel, ackStart, ackEnd);
+        return true;
+    }
+
+    std::vector<nRF24L01P_sim*> radios;
+    unsigned int collisions;
+
+private:
+    struct interval_t
+    {
+        int channel;
+        uint64_t start, end;
+    };
+
+    bool busy(int channel, uint64_t start, uint64_t end)
+    {
+        for (size_t i = 0; i < onAirLog.size(); ++i)
+        {
+            const interval_t& a = onAirLog[i];
+            if (a.channel == channel && a.start < end && a.end > start) return true;
+        }
+        return false;
+    }
+
+    void add(int channel, uint64_t start, uint64_t end)
+    {
+        // Nothing on air is longer than a millisecond
+        while (!onAirLog.empty() && onAirLog.front().end + 1000 < start)
+            onAirLog.erase(onAirLog.begin());
+
+        interval_t a = { channel, start, end };
+        onAirLog.push_back(a);
+    }
+
+    std::vector<interval_t> onAirLog;
+};
+
+
+
+// A controller, its robot and their radios. The controller's clock runs at
+// its own rate from its own phase.
+struct ArenaPair
+{
+    ArenaPair(int i) : robotChip(ARENA_SCK, ARENA_PIN(6*i), ARENA_PIN(6*i + 1), ARENA_PIN(6*i + 2)),
+                       ctrlChip(ARENA_SCK, ARENA_PIN(6*i + 3), ARENA_PIN(6*i + 4), ARENA_PIN(6*i + 5)),
+                       robot(p5, p6, ARENA_SCK, ARENA_PIN(6*i), ARENA_PIN(6*i + 1), ARENA_PIN(6*i + 2)),
+                       ctrl(p5, p6, ARENA_SCK, ARENA_PIN(6*i + 3), ARENA_PIN(6*i + 4)),
+                       schedule(i), offset(0.0), rate(1.0), superframe(0), lastWord(0), lastTime(0)
+    {
+    }
+
+    nRF24L01P_sim robotChip;
+    nRF24L01P_sim ctrlChip;
+    Radio robot;
+    RadioController ctrl;
+    ArenaSchedule schedule;
+
+    double offset;                  // Controller clock at the start, us
+    double rate;                    // And its ticks per arena us
+    uint32_t superframe;            // Next one to send in
+    std::vector<uint64_t> sentAt;   // When each controller word went out
+    uint32_t lastWord;              // Last word the robot got
+    uint64_t lastTime;              // And when, 0 before the first
+};
+
+
+
+struct arena_result_t
+{
+    unsigned int sent;              // Controller frames
+    unsigned int control;           // Reached their robot
+    unsigned int telemetry;         // ACK payloads back at the controller
+    unsigned int crossTalk;         // Words a robot got from another controller
+    unsigned int timeouts;          // Times a robot's word dropped to 0
+    unsigned int collisions;
+    std::vector<uint32_t> latency;  // From transmit() to the robot's poll(), us
+    uint32_t worstGap;              // Longest a robot went without a new word, once it had one
+};
+
+
+
+static void runArena(arena_mode_t mode, int pairs, double seconds, arena_result_t& result)
+{
+    ArenaAir air;
+    std::vector<ArenaPair*> pair;
+
+    result.sent = result.control = result.telemetry = result.crossTalk = result.timeouts = 0;
+    result.latency.clear();
+    result.worstGap = 0;
+
+    for (int i = 0; i < pairs; ++i)
+    {
+        ArenaPair* p = new ArenaPair(i);
+        p->robotChip.setAir(&air);
+        p->ctrlChip.setAir(&air);
+        air.radios.push_back(&p->robotChip);
+        air.radios.push_back(&p->ctrlChip);
+
+        if (mode == ARENA_SINGLE)
+        {
+            p->robot.controller = i;
+            p->ctrl.controller = i;
+        }
+        else
+        {
+            p->robot.setSchedule(&p->schedule);
+            p->ctrl.setSchedule(&p->schedule);
+        }
+        p->robot.reset(LINK_ACK_PAYLOAD);
+        p->ctrl.reset(LINK_ACK_PAYLOAD);
+        p->robot.poll();
+
+        if (mode != ARENA_TDMA)
+        {
+            p->offset = rand() % ARENA_FRAME_US;
+            p->rate = 1.0 + (rand() % 201 - 100) * 0.000001;
+            while (p->schedule.slotStart(p->superframe) < p->offset) ++p->superframe;
+        }
+        pair.push_back(p);
+    }
+
+    uint64_t start = SimClock::now();
+    uint64_t end = start + (uint64_t)(seconds * 1000000.0);
+
+    while (SimClock::now() < end)
+    {
+        uint64_t now = SimClock::now();
+
+        for (int i = 0; i < pairs; ++i)
+        {
+            ArenaPair& p = *pair[i];
+            radio_frame_t frame;
+
+            // Controller. Sends at the start of its slot by its own clock,
+            // and picks up the telemetry once each frame is done.
+            p.ctrl.service();
+            if (!p.ctrl.transmitting())
+            {
+                while (p.ctrl.receive(frame))
+                    ++result.telemetry;
+            }
+
+            double local = p.offset + (now - start) * p.rate;
+            if (local >= p.schedule.slotStart(p.superframe))
+            {
+                // Words count up from 1, with the pair in the top byte
+                uint32_t word = (i << 24) | (p.sentAt.size() + 1);
+                bool sent = (mode == ARENA_SINGLE) ? p.ctrl.transmit(word) : p.ctrl.transmit(word, p.superframe);
+                if (sent)
+                {
+                    p.sentAt.push_back(now);
+                    ++result.sent;
+                }
+                ++p.superframe;
+            }
+
+            // Robot. Loads the next telemetry frame for the ACK once the
+            // last one has gone.
+            p.robot.service();
+            const radio_state_t& state = p.robot.poll();
+
+            if (state.controller != p.lastWord)
+            {
+                if (!state.controller) ++result.timeouts;
+                else if ((int)(state.controller >> 24) != i) ++result.crossTalk;
+                else
+                {
+                    uint32_t n = state.controller & 0xffffff;
+                    result.latency.push_back(now - p.sentAt[n - 1]);
+                    if (p.lastTime) result.worstGap = std::max(result.worstGap, (uint32_t)(now - p.lastTime));
+                    p.lastTime = now;
+                    ++result.control;
+                }
+                p.lastWord = state.controller;
+            }
+
+            if (!p.robot.ackPending())
+            {
+                frame.seq = p.sentAt.size();
+                frame.types = 1<<MSG_TIMING;
+                frame.period = ARENA_FRAME_US;
+                frame.tick = 0;
+                frame.tickMax = 0;
+                p.robot.setAckPayload(frame);
+            }
+        }
+
+        wait_us(ARENA_STEP_US);
+    }
+
+    for (int i = 0; i < pairs; ++i)
+    {
+        if (pair[i]->lastTime) result.worstGap = std::max(result.worstGap, (uint32_t)(end - pair[i]->lastTime));
+        delete pair[i];
+    }
+    result.collisions = air.collisions;
+}
+
+
+
+int main(int argc, char** argv)
+{
+    int pairs = 8;
+    double seconds = 20.0;
+    unsigned int seed = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) pairs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) seed = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "usage: %s [-n pairs] [-t seconds] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (pairs < 1 || pairs > ARENA_PAIRS)
+    {
+        fprintf(stderr, "Between 1 and %d pairs\n", ARENA_PAIRS);
+        return 1;
+    }
+
+    printf("%d pairs, %.0f s, frames every %d ms\n", pairs, seconds, ARENA_FRAME_US/1000);
+    printf("mode    control  telemetry  latency mean   p99    max  worst gap  timeouts  cross  collisions\n");
+
+    for (int m = ARENA_SINGLE; m <= ARENA_HOP; ++m)
+    {
+        arena_result_t result;
+        srand(seed);
+        runArena((arena_mode_t)m, pairs, seconds, result);
+
+        std::vector<uint32_t>& l = result.latency;
+        std::sort(l.begin(), l.end());
+        double mean = 0.0;
+        for (size_t i = 0; i < l.size(); ++i)
+            mean += l[i];
+        if (!l.empty()) mean /= l.size();
+        uint32_t p99 = l.empty() ? 0 : l[l.size()*99/100];
+        uint32_t max = l.empty() ? 0 : l.back();
+
+        printf("%-6s  %6.1f%%    %6.1f%%    %7.0f us %5u %6u  %6.1f ms  %8u  %5u  %10u\n",
+               modeNames[m], 100.0 * result.control / result.sent, 100.0 * result.telemetry / result.sent,
+               mean, p99, max, result.worstGap * 0.001, result.timeouts, result.crossTalk, result.collisions);
+    }
+
+    return 0;
+}
+
+#endif // HAL_POSIX
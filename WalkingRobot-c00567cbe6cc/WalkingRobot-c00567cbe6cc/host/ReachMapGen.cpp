@@ -0,0 +1,271 @@
+// Reachability map generator
+//
+// Classifies a grid over each leg's workspace by solving the same IK the
+// robot runs at a number of points in every cell, using the servo calibration
+// in Gait.cpp and the geometry in LegGeometry.h. Writes ReachMapData.cpp to
+// stdout; rerun it whenever either of those changes:
+//
+//   ReachMapGen > ReachMapData.cpp
+//
+// A stale map is not used: RobotLeg::setReachMap checks it against the leg's
+// calibrated limits, dimensions and angle offsets.
+//
+// usage: ReachMapGen [-s cell size in metres] [-n samples per cell edge]
+
+#ifdef HAL_POSIX
+
+#include "Gait.h"
+#include "ReachMap.h"
+#include "LegBatch.h"
+#include <vector>
+
+
+
+struct grid_t
+{
+    float x0, y0, z0;
+    float cell;
+    int nx, ny, nz;
+    std::vector<uint8_t> cells;
+    int counts[3];
+};
+
+
+
+static void setupLane(LegBatch& k, int legIndex)
+{
+    const servo_cal_t* cal = servoCalibration[legIndex];
+
+    k.a[0] = DIM_A;
+    k.b[0] = DIM_B;
+    k.c[0] = DIM_C;
+    k.d[0] = DIM_D;
+    k.oth[0] = OFFSET_THETA;
+    k.oph[0] = OFFSET_PHI;
+    k.ops[0] = OFFSET_PSI;
+    k.thetaMin[0] = cal[0].lower;
+    k.thetaMax[0] = cal[0].upper;
+    k.phiMin[0] = cal[1].lower;
+    k.phiMax[0] = cal[1].upper;
+    k.psiMin[0] = cal[2].lower;
+    k.psiMax[0] = cal[2].upper;
+}
+
+
+
+// Bounding box of the foot over the joint limits, from the forward kinematics
+// in RobotLeg::getPosition
+static void workspaceBounds(const LegBatch& k, float* lo, float* hi)
+{
+    const float deg2rad = 0.01745329f;
+    const float stepDeg = 1.0f;
+    float a = k.a[0], b = k.b[0], c = k.c[0], d = k.d[0];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        lo[i] = 1e9f;
+        hi[i] = -1e9f;
+    }
+
+    for (float th = k.thetaMin[0]; th <= k.thetaMax[0] + 0.5f*stepDeg; th += stepDeg)
+    {
+        float thR = th*deg2rad + k.oth[0];
+        for (float ph = k.phiMin[0]; ph <= k.phiMax[0] + 0.5f*stepDeg; ph += stepDeg)
+        {
+            float phR = ph*deg2rad + k.oph[0];
+            for (float ps = k.psiMin[0]; ps <= k.psiMax[0] + 0.5f*stepDeg; ps += stepDeg)
+            {
+                float psR = ps*deg2rad + k.ops[0];
+                float L = a*cos(phR) + b*sin(phR + psR);
+                float p[3];
+                p[0] = -c*sin(thR) + (L + d)*cos(thR);
+                p[1] = c*cos(thR) + (L + d)*sin(thR);
+                p[2] = a*sin(phR) - b*cos(phR + psR);
+
+                for (int i = 0; i < 3; ++i)
+                {
+                    if (p[i] < lo[i]) lo[i] = p[i];
+                    if (p[i] > hi[i]) hi[i] = p[i];
+                }
+            }
+        }
+    }
+}
+
+
+
+static void buildGrid(LegBatch& k, float cell, int samples, grid_t& g)
+{
+    float lo[3], hi[3];
+    workspaceBounds(k, lo, hi);
+
+    // One cell of margin, corner snapped to the cell size
+    g.cell = cell;
+    g.x0 = floorf(lo[0]/cell - 1.0f)*cell;
+    g.y0 = floorf(lo[1]/cell - 1.0f)*cell;
+    g.z0 = floorf(lo[2]/cell - 1.0f)*cell;
+    g.nx = (int)ceilf((hi[0] - g.x0)/cell + 1.0f);
+    g.ny = (int)ceilf((hi[1] - g.y0)/cell + 1.0f);
+    g.nz = (int)ceilf((hi[2] - g.z0)/cell + 1.0f);
+    g.cells.assign((g.nx*g.ny*g.nz + 3)/4, 0);
+    g.counts[0] = g.counts[1] = g.counts[2] = 0;
+
+    std::vector<uint8_t> value(g.nx*g.ny*g.nz);
+    for (int iz = 0; iz < g.nz; ++iz)
+    for (int iy = 0; iy < g.ny; ++iy)
+    for (int ix = 0; ix < g.nx; ++ix)
+    {
+        // Samples include the faces of the cell, so neighbours agree on them
+        int reachable = 0;
+        for (int sz = 0; sz < samples; ++sz)
+        for (int sy = 0; sy < samples; ++sy)
+        for (int sx = 0; sx < samples; ++sx)
+        {
+            float f = cell/(samples - 1);
+            k.tx[0] = g.x0 + ix*cell + sx*f;
+            k.ty[0] = g.y0 + iy*cell + sy*f;
+            k.tz[0] = g.z0 + iz*cell + sz*f;
+            if (k.solve<LaneGeometry>(0)) ++reachable;
+        }
+
+        int v = REACH_EDGE;
+        if (reachable == 0) v = REACH_OUT;
+        else if (reachable == samples*samples*samples) v = REACH_IN;
+        value[(iz*g.ny + iy)*g.nx + ix] = v;
+    }
+
+    // The samples can miss a sliver of reach inside a cell, so a cell with
+    // none next to one with some is only known after solving the IK
+    for (int iz = 0; iz < g.nz; ++iz)
+    for (int iy = 0; iy < g.ny; ++iy)
+    for (int ix = 0; ix < g.nx; ++ix)
+    {
+        int i = (iz*g.ny + iy)*g.nx + ix;
+        int v = value[i];
+        if (REACH_OUT == v)
+        {
+            for (int dz = -1; dz <= 1; ++dz)
+            for (int dy = -1; dy <= 1; ++dy)
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                int jx = ix + dx, jy = iy + dy, jz = iz + dz;
+                if (jx < 0 || jy < 0 || jz < 0 || jx >= g.nx || jy >= g.ny || jz >= g.nz) continue;
+                if (REACH_OUT != value[(jz*g.ny + jy)*g.nx + jx]) v = REACH_EDGE;
+            }
+        }
+
+        g.cells[i >> 2] |= v << ((i & 3)*2);
+        g.counts[v]++;
+    }
+}
+
+
+
+// Float literal that reads back to the same value
+static const char* literal(float f)
+{
+    static char bufs[8][32];
+    static int next = 0;
+    char* buf = bufs[next++ & 7];
+
+    snprintf(buf, 24, "%.9g", f);
+    if (!strpbrk(buf, ".en")) strcat(buf, ".0");
+    strcat(buf, "f");
+    return buf;
+}
+
+
+
+static bool sameLimits(int i, int j)
+{
+    for (int n = 0; n < 3; ++n)
+    {
+        if (servoCalibration[i][n].lower != servoCalibration[j][n].lower) return false;
+        if (servoCalibration[i][n].upper != servoCalibration[j][n].upper) return false;
+    }
+    return true;
+}
+
+
+
+int main(int argc, char** argv)
+{
+    const char* names = "ABCD";
+    float cell = 0.01f;
+    int samples = 5;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc) cell = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) samples = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "usage: %s [-s cell size in metres] [-n samples per cell edge]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (cell <= 0.0f || samples < 2)
+    {
+        fprintf(stderr, "Cell size must be positive and samples at least 2\n");
+        return 1;
+    }
+
+    static LegBatch k;
+    grid_t grids[4];
+    int source[4];
+
+    printf("// Generated by host/ReachMapGen.cpp, do not edit. Regenerate whenever the\n");
+    printf("// servo calibration in Gait.cpp or the geometry in LegGeometry.h changes.\n");
+    printf("// Cell size %g m, %d samples per cell edge.\n\n", cell, samples);
+    printf("#include \"ReachMap.h\"\n");
+
+    for (int leg = 0; leg < 4; ++leg)
+    {
+        // Legs with the same limits share their cells
+        source[leg] = leg;
+        for (int j = 0; j < leg; ++j)
+        {
+            if (source[j] == j && sameLimits(leg, j))
+            {
+                source[leg] = j;
+                break;
+            }
+        }
+        if (source[leg] != leg) continue;
+
+        grid_t& g = grids[leg];
+        setupLane(k, leg);
+        buildGrid(k, cell, samples, g);
+
+        fprintf(stderr, "leg %c: %d x %d x %d cells, %u bytes, %d out %d in %d edge\n",
+                names[leg], g.nx, g.ny, g.nz, (unsigned int)g.cells.size(),
+                g.counts[REACH_OUT], g.counts[REACH_IN], g.counts[REACH_EDGE]);
+
+        printf("\n\n\nstatic const uint8_t cells%c[%u] =\n{", names[leg], (unsigned int)g.cells.size());
+        for (size_t i = 0; i < g.cells.size(); ++i)
+            printf("%s0x%02x%s", (i % 16) ? " " : "\n    ", g.cells[i], (i + 1 < g.cells.size()) ? "," : "");
+        printf("\n};\n");
+    }
+
+    printf("\n\n\nconst ReachMap reachMaps[4] =\n{\n");
+    for (int leg = 0; leg < 4; ++leg)
+    {
+        const grid_t& g = grids[source[leg]];
+        const servo_cal_t* cal = servoCalibration[leg];
+        printf("    { %s, %s, %s, %s, %d, %d, %d, cells%c,\n",
+               literal(g.x0), literal(g.y0), literal(g.z0), literal(1.0f/g.cell), g.nx, g.ny, g.nz, names[source[leg]]);
+        printf("      { %s, %s, %s, %s, %s, %s },\n",
+               literal(cal[0].lower), literal(cal[0].upper), literal(cal[1].lower),
+               literal(cal[1].upper), literal(cal[2].lower), literal(cal[2].upper));
+        printf("      { %s, %s, %s, %s },\n",
+               literal(DIM_A), literal(DIM_B), literal(DIM_C), literal(DIM_D));
+        printf("      { %s, %s, %s } }%s\n",
+               literal(OFFSET_THETA), literal(OFFSET_PHI), literal(OFFSET_PSI), leg < 3 ? "," : "");
+    }
+    printf("};\n");
+
+    return 0;
+}
+
+#endif // HAL_POSIX
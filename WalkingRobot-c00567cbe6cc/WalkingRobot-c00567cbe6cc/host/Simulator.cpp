@@ -0,0 +1,300 @@
+// Closed loop gait simulator
+//
+// Runs the control loop from main() against the POSIX HAL. Controller packets
+// are replayed through the simulated nRF24L01+ into Radio::service, and the
+// loop is clocked by SimClock rather than a wall clock, so a run is fully
+// deterministic and limited only by host CPU speed.
+//
+// Input is a recorded controller word stream, one packet per line:
+//
+//   <time in seconds> <controller word in hex>
+//
+// Blank lines and lines starting with '#' are ignored. Alternatively -c gives
+// a constant controller word that is sent every 20 ms.
+//
+// -l writes the robot's binary tick log, as "log start" does on the robot,
+// for host/LogDecode.
+//
+// -r and -p set the control and planning rates in Hz, as the "rate" command
+// does on the robot.
+//
+// -g picks the footstep policy, greedy or lookahead, as the "steps" command
+// does on the robot, and -m the gait mode, crawl, amble or trot, as the "gait"
+// command does. -s on or off switches the body sway, as "sway" does.
+//
+// Besides the distance, a run reports the time stalled per metre walked. A
+// tick is stalled if the commanded motion was not applied, or a planted foot
+// is being dragged more than DRAG_SLACK outside its step circle, and the body
+// only counts as walking on ticks that are not dragged.
+//
+// usage: Simulator [-i stream.txt] [-c word] [-t seconds] [-r hz] [-p hz] [-g policy] [-m mode] [-s on|off] [-o ticks.csv] [-e events.csv] [-l log.bin]
+
+#ifdef HAL_POSIX
+
+#include "Gait.h"
+#include "DataLog.h"
+#include "Radio.h"
+#include "nRF24L01P_sim.h"
+#include "nRF24L01P_defs.h"
+#include <vector>
+#include <ctime>
+
+#define DRAG_SLACK 0.02f
+
+
+
+struct packet_t
+{
+    uint64_t time;
+    uint32_t data;
+};
+
+nRF24L01P_sim chip(p7, p16, p17, p18);
+Radio radio(p5, p6, p7, p16, p17, p18);
+
+
+
+static bool loadStream(const char* filename, std::vector<packet_t>& packets)
+{
+    FILE* f = fopen(filename, "r");
+    if (!f) return false;
+
+    char line[128];
+    while (fgets(line, sizeof(line), f))
+    {
+        double t;
+        unsigned int data;
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%lf %x", &t, &data) != 2) continue;
+
+        packet_t p;
+        p.time = (uint64_t)(t * 1000000.0);
+        p.data = data;
+        packets.push_back(p);
+    }
+
+    fclose(f);
+    return true;
+}
+
+
+
+// Sends a controller word the way RadioController does, as a one message frame
+static void sendController(uint32_t word)
+{
+    static uint8_t seq = 0;
+    const uint8_t address[3] = { CTRL_BASE_ADDRESS_1, CTRL_BASE_ADDRESS_2, CTRL_BASE_ADDRESS_3 };
+    radio_frame_t frame;
+    uint8_t data[FRAME_MAX_LENGTH];
+
+    frame.seq = seq++;
+    frame.types = 1<<MSG_CONTROLLER;
+    frame.controller = word;
+    chip.receivePacket(RF_CHANNEL, address, 3, data, encodeFrame(frame, data));
+}
+
+
+
+static double wallTime()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+
+int main(int argc, char** argv)
+{
+    std::vector<packet_t> packets;
+    const char* ticksFile = NULL;
+    const char* eventsFile = NULL;
+    const char* logFile = NULL;
+    unsigned int constant = 0;
+    bool useConstant = false;
+    double duration = -1.0;
+    float period = PERIOD;
+    float planning = PLAN_PERIOD;
+    step_policy_t policy = STEP_LOOKAHEAD;
+    gait_mode_t mode = GAIT_CRAWL;
+    bool sway = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)
+        {
+            if (!loadStream(argv[++i], packets))
+            {
+                fprintf(stderr, "Cannot read %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+        {
+            sscanf(argv[++i], "%x", &constant);
+            useConstant = true;
+        }
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc) duration = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) ticksFile = argv[++i];
+        else if (!strcmp(argv[i], "-e") && i + 1 < argc) eventsFile = argv[++i];
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc) logFile = argv[++i];
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) period = 1.0f / atof(argv[++i]);
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) planning = 1.0f / atof(argv[++i]);
+        else if (!strcmp(argv[i], "-g") && i + 1 < argc) policy = strcmp(argv[++i], "greedy") ? STEP_LOOKAHEAD : STEP_GREEDY;
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) sway = strcmp(argv[++i], "off") != 0;
+        else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+        {
+            ++i;
+            for (int m = 0; m < GAIT_MODES; ++m)
+                if (!strcmp(argv[i], gaitModeName((gait_mode_t)m))) mode = (gait_mode_t)m;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-i stream.txt] [-c word] [-t seconds] [-r hz] [-p hz] [-g policy] [-m mode] [-s on|off] [-o ticks.csv] [-e events.csv] [-l log.bin]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (duration < 0.0)
+        duration = packets.empty() ? 10.0 : packets.back().time * 0.000001 + 1.0;
+
+    FILE* ticks = ticksFile ? fopen(ticksFile, "w") : NULL;
+    FILE* events = eventsFile ? fopen(eventsFile, "w") : NULL;
+    if (ticks)
+    {
+        fprintf(ticks, "t,moved");
+        for (int i = 0; i < 4; ++i)
+            fprintf(ticks, ",x%d,y%d,z%d,stability%d,stepdist%d", i, i, i, i, i);
+        fprintf(ticks, "\n");
+    }
+    if (events) fprintf(events, "t,leg,event,x,y,z\n");
+
+    // Same start up sequence as the robot
+    radio.reset();
+    setupLegs();
+    setPlanPeriod(planning);
+    setStepPolicy(policy);
+    setGaitMode(mode);
+    setBodySway(sway);
+    setupTransforms();
+
+    uint64_t start = SimClock::now();
+    uint64_t end = start + (uint64_t)(duration * 1000000.0);
+    uint64_t nextConstant = start;
+    unsigned int nextPacket = 0;
+    unsigned long tickCount = 0;
+    unsigned long stalled = 0;
+    unsigned long dragged = 0;
+    double stalledTime = 0.0;
+    unsigned long steps[4] = { 0, 0, 0, 0 };
+    bool wasStepping[4];
+    float minStability = 1.0f;
+    rigid2 body;
+    rigid2 walked;
+
+    for (int i = 0; i < 4; ++i)
+        wasStepping[i] = leg[i]->getStepping();
+
+    if (logFile)
+    {
+        dataLog.start(logFile);
+        dataLog.service();
+        if (!dataLog.writing())
+        {
+            fprintf(stderr, "Cannot write %s\n", logFile);
+            return 1;
+        }
+    }
+
+    double wallStart = wallTime();
+
+    while (SimClock::now() < end)
+    {
+        wait(period);
+        uint64_t now = SimClock::now() - start;
+
+        // Deliver everything that arrived during the last period
+        while (nextPacket < packets.size() && packets[nextPacket].time <= now)
+            sendController(packets[nextPacket++].data);
+        if (useConstant && SimClock::now() >= nextConstant)
+        {
+            sendController(constant);
+            nextConstant += 20000;
+        }
+        radio.service();
+        dataLog.service();
+
+        const radio_state_t& state = radio.poll();
+        uint32_t tickStart = radio.time();
+        uint32_t c0 = cycleCount();
+        controlTick(state.controller, period);
+        int tick = (int)((uint64_t)(cycleCount() - c0) * 1000000 / cycleFrequency());
+        dataLog.tick(tickStart, (int)(period*1000000.0f), tick, state.controller, state.controllerFrame);
+        ++tickCount;
+
+        // Track the body in world coordinates. Feet are moved by the motion
+        // transform, so the body moves by its inverse.
+        body = body * gaitStatus.motion.inverse();
+        if (!gaitStatus.moved) ++stalled;
+
+        bool drag = false;
+        for (int i = 0; i < 4; ++i)
+        {
+            vector3 q = leg[i]->getPosition();
+            float dx = q.x - CIRCLE_X;
+            float dy = q.y - CIRCLE_Y;
+            if (!leg[i]->getStepping() && dx*dx + dy*dy > (CIRCLE_R + DRAG_SLACK)*(CIRCLE_R + DRAG_SLACK)) drag = true;
+        }
+        if (drag) ++dragged;
+        else walked = walked * gaitStatus.motion.inverse();
+        if (drag || !gaitStatus.moved) stalledTime += period;
+
+        double t = now * 0.000001;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (gaitStatus.stability[i] < minStability) minStability = gaitStatus.stability[i];
+
+            bool s = leg[i]->getStepping();
+            if (s != wasStepping[i])
+            {
+                vector3 p = QMat[i]*leg[i]->getFootPosition();
+                if (s) ++steps[i];
+                if (events) fprintf(events, "%.3f,%d,%s,%.5f,%.5f,%.5f\n", t, i, s ? "lift" : "land", p.x, p.y, p.z);
+                wasStepping[i] = s;
+            }
+        }
+
+        if (ticks)
+        {
+            fprintf(ticks, "%.3f,%d", t, gaitStatus.moved ? 1 : 0);
+            for (int i = 0; i < 4; ++i)
+            {
+                vector3 p = QMat[i]*leg[i]->getFootPosition();
+                fprintf(ticks, ",%.5f,%.5f,%.5f,%.5f,%.5f", p.x, p.y, p.z, gaitStatus.stability[i], gaitStatus.stepDistance[i]);
+            }
+            fprintf(ticks, "\n");
+        }
+    }
+
+    double wall = wallTime() - wallStart;
+    double simulated = (SimClock::now() - start) * 0.000001;
+    float distance = sqrt(body.x*body.x + body.y*body.y);
+    float walkedDistance = sqrt(walked.x*walked.x + walked.y*walked.y);
+
+    fprintf(stderr, "simulated %.1f s in %.3f s wall (%.0fx real time), %lu ticks\n",
+            simulated, wall, simulated / wall, tickCount);
+    fprintf(stderr, "distance %.3f m, heading %.1f deg, stalled %.1f%% of ticks, min stability %.4f m\n",
+            distance, atan2(body.s, body.c) * 57.2958, 100.0 * stalled / tickCount, minStability);
+    fprintf(stderr, "steps A %lu  B %lu  C %lu  D %lu\n", steps[0], steps[1], steps[2], steps[3]);
+    fprintf(stderr, "walked %.3f m, dragged %.1f%% of ticks, stalled %.1f s, %.3f s per m\n", walkedDistance,
+            100.0 * dragged / tickCount, stalledTime, walkedDistance > 0.01f ? stalledTime / walkedDistance : 0.0);
+
+    if (ticks) fclose(ticks);
+    if (events) fclose(events);
+    dataLog.stop();
+    dataLog.service();
+
+    return 0;
+}
+
+#endif // HAL_POSIX
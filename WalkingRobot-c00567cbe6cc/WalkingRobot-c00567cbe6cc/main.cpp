@@ -1,375 +1,550 @@
 #include "mbed.h"
-#include "RobotLeg.h"
-#include "Matrix.h"
-#include "CircularBuffer.h"
+#include "Gait.h"
+#include "Profiler.h"
+#include "DataLog.h"
+#include "TextOut.h"
+#include "Scheduler.h"
 #include "Radio.h"
 #include "Terminal.h"
-#include "utility.h"
 #include <cstring>
 #include <cmath>
 
-#define MAXSPEED 0.1f
-#define MAXTURN 1.0f
-#define RESET_STEP_TIME 0.4f
-#define DIM_A 0.125f
-#define DIM_B 0.11f
-#define DIM_C 0.0025f
-#define DIM_D 0.0275f
-#define CIRCLE_X 0.095f
-#define CIRCLE_Y 0.095f
-#define CIRCLE_Z -0.12f
-#define CIRCLE_R 0.09f
-#define PERIOD 0.005f
+// How telemetry goes back, has to match the controller
+#define RADIO_LINK LINK_ACK_PAYLOAD
 
+// Arena pair the robot and its controller are set to, or -1 for the fixed
+// channel
+#define RADIO_PAIR -1
 
 
-CircularBuffer<float,16> dataLog;
-Radio radio(p5, p6, p7, p16, p17, p18);
-RobotLeg legA(p26, p29, p30, false);
-RobotLeg legB(p13, p14, p15, false);
-RobotLeg legC(p19, p11, p8, false);
-RobotLeg legD(p25, p24, p23, false);
-RobotLeg* leg[4] = { &legA, &legB, &legC, &legD };
-matrix4 QMat[4];
-matrix4 PMat[4];
 
-DigitalOut led1(LED1);
-DigitalOut led2(LED2);
-DigitalOut led3(LED3);
-DigitalOut led4(LED4);
+LocalFileSystem local("local");
+Radio radio(p5, p6, p7, p16, p17, p18);
+ArenaSchedule arena(RADIO_PAIR < 0 ? 0 : RADIO_PAIR);
+radio_state_t radioState; // Copy from the last tick, for the terminal
 
 
 
-CmdHandler* legpos(Terminal* terminal, const char*)
+// Foot positions in leg coordinates
+CmdHandler* legpos(Terminal*, const char*)
 {
     char output[256];
-    char abuf[64];
-    char bbuf[64];
-    char cbuf[64];
-    char dbuf[64];
-    legA.getPosition().print(abuf, 64);
-    legB.getPosition().print(bbuf, 64);
-    legC.getPosition().print(cbuf, 64);
-    legD.getPosition().print(dbuf, 64);
-    snprintf(output, 256, "A = [%s]\nB = [%s]\nC = [%s]\nD = [%s]", abuf, bbuf, cbuf, dbuf);
-    terminal->write(output);
+    TextLine line(output, 256);
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        vector3 p = leg[i]->getPosition();
+        line.put('A' + i).text(" = [").fixed(p.x, 4).put('\t').fixed(p.y, 4).put('\t').fixed(p.z, 4).text("]\n");
+    }
+    textOut.write(output, line.length());
     return NULL;
 }
 
 
 
-CmdHandler* log(Terminal* terminal, const char* input)
+// Line of a "log dump" to queue next, -1 when there is none
+volatile int dumpLine = -1;
+
+// Queues the next line of a dump once the terminal ring has room for it.
+// The log is held until the dump is done, so it goes out as one snapshot
+// however long the serial link takes.
+void dumpService()
+{
+    int i = dumpLine;
+    if (i < 0 || textOut.space() < 130) return;
+    
+    if (i >= dataLog.blocks()*(LOG_BLOCK_SIZE/64))
+    {
+        dumpLine = -1;
+        dataLog.held = false;
+        return;
+    }
+    
+    // 64 bytes a line
+    char output[130];
+    TextLine line(output, 130);
+    const uint8_t* p = (const uint8_t*)&dataLog.block(i/(LOG_BLOCK_SIZE/64)) + 64*(i%(LOG_BLOCK_SIZE/64));
+    for (int k = 0; k < 64; ++k)
+        line.hex(p[k], 2);
+    line.put('\n');
+    textOut.write(output, line.length());
+    dumpLine = i + 1;
+}
+
+
+
+// log              status
+// log dump         the blocks in RAM as hex, for host/LogDecode
+// log start NAME   write to /local/NAME, starting with what is in RAM
+// log stop
+CmdHandler* log(Terminal*, const char* input)
 {
-    int start = 0;
-    int end = 15;
     char output[256];
+    char name[16];
     
-    if (sscanf(input, "log %d %d", &start, &end) == 1)
+    if (sscanf(input, "log start %12s", name) == 1)
     {
-        // Print only one item
-        snprintf(output, 256, "%4d: %f\n", start, dataLog[start]);
-        terminal->write(output);
+        strcpy(output, "/local/");
+        strcat(output, name);
+        dataLog.start(output);
+        textOut.write("Logging\n");
+        return NULL;
     }
-    else
+    
+    if (!strcmp(input, "log stop"))
     {
-        // Print a range of items
-        for (int i = start; i <= end; i++)
+        dataLog.stop();
+        textOut.write("Log closed\n");
+        return NULL;
+    }
+    
+    if (!strcmp(input, "log dump"))
+    {
+        // Blocks going out to the file move through the ring
+        if (dataLog.writing())
         {
-            snprintf(output, 256, "%4d: %f\n", i, dataLog[i]);
-            terminal->write(output);
+            textOut.write("Stop the log first\n");
+            return NULL;
         }
-    }  
+        dataLog.held = true;
+        dumpLine = 0;
+        return NULL;
+    }
     
+    TextLine line(output, 256);
+    line.number((unsigned long)dataLog.records).text(" records, ").number((long)dataLog.blocks());
+    line.text(" blocks in RAM, ").text(dataLog.writing() ? "writing" : "not writing");
+    line.text(", ").number((unsigned long)dataLog.written).text(" blocks written, ");
+    line.number((unsigned long)dataLog.dropped).text(" records dropped\n");
+    textOut.write(output, line.length());
     return NULL;
 } // log()
 
 
 
-bool processMovement(matrix4& TMat);
-void setupLegs();
-void resetLegs();
-float calcStability(vector3 p1, vector3 p2);
-
-
-
-int main()
+CmdHandler* prof(Terminal*, const char* input)
 {
-    Timer deltaTimer;
-    Terminal terminal;
+    char output[256];
     
-    terminal.addCommand("log", &log);
-    terminal.addCommand("leg", &legpos);
+    if (!strcmp(input, "prof reset"))
+    {
+        profiler.reset();
+        textOut.write("Profiler reset\n");
+        return NULL;
+    }
     
-    radio.reset();
-    setupLegs();
+    TextLine header(output, 256);
+    header.text("stage             count      min      p50      p99      max  (cycles @ ");
+    header.number((unsigned long)cycleFrequency()).text(" Hz)\n");
+    textOut.write(output, header.length());
+    for (int i = 0; i < PROFILE_STAGES; ++i)
+        textOut.write(output, profiler.print(output, 256, (profile_stage_t)i));
     
-    // Initialize matrices to change base from robot coordinates to leg coordinates
-    QMat[0].translate(vector3(0.0508f, 0.0508f, 0.0f));
-    QMat[1].translate(vector3(-0.0508f, -0.0508f, 0.0f));
-    QMat[1].a11 = -1.0f; QMat[1].a22 = -1.0f;
-    QMat[2].translate(vector3(-0.0508f, 0.0508f, 0.0f));
-    QMat[2].a11 = -1.0f;
-    QMat[3].translate(vector3(0.0508f, -0.0508f, 0.0f));
-    QMat[3].a22 = -1.0f;
+    // Share of the control period used by the p99 and worst case tick
+    static const float periods[] = { 0.005f, 0.0025f, 0.002f };
+    static const char* rates[] = { " @ 200 Hz", " @ 400 Hz", " @ 500 Hz\n" };
+    TextLine line(output, 256);
+    line.text("budget p99/max: ");
+    for (int i = 0; i < 3; ++i)
+    {
+        if (i) line.text(", ");
+        line.fixed(100.0f*profiler.budget(periods[i], false), 1).text("%/");
+        line.fixed(100.0f*profiler.budget(periods[i], true), 1).put('%').text(rates[i]);
+    }
+    textOut.write(output, line.length());
     
-    PMat[0] = QMat[0].inverse();
-    PMat[1] = QMat[1].inverse();
-    PMat[2] = QMat[2].inverse();
-    PMat[3] = QMat[3].inverse();
+    return NULL;
+} // prof()
+
+
+
+CmdHandler* lat(Terminal*, const char* input)
+{
+    char output[256];
     
-    matrix4 TMat;
+    if (!strcmp(input, "lat reset"))
+    {
+        latencyTrace.reset();
+        textOut.write("Latency reset\n");
+        return NULL;
+    }
     
-    // Start timer
-    deltaTimer.start();
+    textOut.write("stage             count      min      p50      p99      max  (us)\n");
+    for (int i = 0; i < LATENCY_STAGES; ++i)
+        textOut.write(output, latencyTrace.print(output, 256, (latency_stage_t)i));
+    return NULL;
+} // lat()
+
+
+
+CmdHandler* radiostat(Terminal*, const char*)
+{
+    char output[256];
+    TextLine line(output, 256);
     
-    while (true)
-    {
-        while (deltaTimer.read() < PERIOD);
-        
-        // Read controller input
-        float xaxis = 0.0078125f * deadzone((int8_t)((radio.rx_controller>>0)&0xff), 8); // Convert to +/-1.0f range
-        float yaxis = -0.0078125f * deadzone((int8_t)((radio.rx_controller>>8)&0xff), 8);
-        float turnaxis = -0.0078125f * deadzone((int8_t)((radio.rx_controller>>16)&0xff), 8);
-        
-        // Reset legs to sane positions when 'A' button is pressed
-        if ((radio.rx_controller>>25)&0x1) resetLegs();
-        
-        deltaTimer.reset();
-        dataLog.push(deltaTimer.read());
-        
-        // Compute delta movement vector and delta angle
-        vector3 v(-xaxis, -yaxis, 0.0f);
-        v = v * MAXSPEED * PERIOD;
-        float angle = -turnaxis * MAXTURN * PERIOD;
-        
-        // Compute movement transformation in robot coordinates
-        TMat.identity().rotateZ(angle).translate(v).inverse();
-        
-        processMovement(TMat);
-        
-    } // while (true)
-} // main()
+    line.text("controller ").hex(radioState.controller, 8).text(" seq ").number((unsigned long)radioState.controllerSeq);
+    line.text(", lost ").number((unsigned long)radioState.controllerLost);
+    line.text(", received ").number((unsigned long)radioState.received);
+    line.text(", overruns ").number((unsigned long)radioState.overruns);
+    line.text(", bad frames ").number((unsigned long)radioState.badFrames);
+    line.text(", ack payloads ").number((unsigned long)radioState.ackPayloads);
+    line.text(", channel ").number((long)radioState.channel).text(radioState.synced ? " synced\n" : "\n");
+    textOut.write(output, line.length());
+    return NULL;
+}
 
 
 
-bool processMovement(matrix4& TMat)
+CmdHandler* sched(Terminal*, const char* input)
 {
-    // Get points used to calculate stability
-    vector3 point1[4];
-    vector3 point2[4];
-    point1[0] = QMat[2]*leg[2]->getPosition();
-    point1[1] = QMat[3]*leg[3]->getPosition();
-    point1[2] = QMat[1]*leg[1]->getPosition();
-    point1[3] = QMat[0]*leg[0]->getPosition();
-    point2[0] = QMat[3]*leg[3]->getPosition();
-    point2[1] = QMat[2]*leg[2]->getPosition();
-    point2[2] = QMat[0]*leg[0]->getPosition();
-    point2[3] = QMat[1]*leg[1]->getPosition();
-    
-    // Check if each leg can perform this motion, find the next leg to step, and calculate stability of each leg
-    bool legFree[4];
-    float stepDist[4];
-    float stability[4];
-    for (int i = 0; i < 4; ++i)
+    char output[512];
+    
+    if (!strcmp(input, "sched reset"))
     {
-        legFree[i] = leg[i]->update(PMat[i]*TMat*QMat[i]);
-        stepDist[i] = leg[i]->getStepDistance();
-        stability[i] = calcStability(point1[i], point2[i]);
+        scheduler.resetStats();
+        textOut.write("Scheduler reset\n");
+        return NULL;
     }
     
-    // Check if each leg needs to step, and then check if it's stable before stepping
-    bool stepping = leg[0]->getStepping() || leg[1]->getStepping() || leg[2]->getStepping() || leg[3]->getStepping();
-    const float borderMax = 0.015f; // radius of support base in meters
-    const float borderMin = 0.007f;
+    textOut.write(output, scheduler.print(output, 512));
+    return NULL;
+}
+
+
+
+// rate                 control and planning rates
+// rate CONTROL PLAN    set both, in Hz
+CmdHandler* rate(Terminal*, const char* input)
+{
+    char output[128];
+    float control, plan;
     
-    for (int i = 0; i < 4; ++i)
+    if (sscanf(input, "rate %f %f", &control, &plan) == 2)
     {
-        if (!legFree[i])
+        if (control < 50.0f || control > 1000.0f || plan < 10.0f || plan > control)
         {
-            if (stepping)
-            {
-                TMat.identity();
-                return false;
-            }
-            else 
-            {
-                if (stability[i] > borderMin)
-                {
-                    // If stable, step
-                    leg[i]->reset(0.8);
-                    stepping = true;
-                }
-                else
-                {
-//                    // If unstable, move towards a stable position
-//                    vector3 n;
-//                    n.x = point2[i].y - point1[i].y;
-//                    n.y = point1[i].x - point2[i].x;
-//                    n = n.unit() * MAXSPEED * PERIOD;
-//                    TMat.identity().translate(n).inverse();
-//                    return false;
-                }
-            }
+            textOut.write("Control 50 to 1000 Hz, planning 10 Hz to the control rate\n");
+            return NULL;
         }
+        scheduler.setPeriod(1.0f / control);
+        setPlanPeriod(1.0f / plan);
     }
     
-    // Check if the next leg to step is stable
-    int next = least(stepDist[0], stepDist[1], stepDist[2], stepDist[3]);
-    if (stability[next] > borderMax)
-    {
-        // Continue to carry out step as normal
-    }
-    else if (stability[next] > borderMin)
+    TextLine line(output, 128);
+    line.text("control ").fixed(1.0f / (scheduler.period()), 0).text(" Hz, planning ");
+    line.fixed(1.0f / planPeriod(), 0).text(" Hz\n");
+    textOut.write(output, line.length());
+    return NULL;
+}
+
+
+
+// Terminal commands run from the serial interrupt, possibly partway through
+// a tick, so settings the tick reads are only requested there. takeRequests()
+// applies them before the next tick, as the scheduler does with a new rate.
+// -1 while nothing is pending.
+volatile int stepPolicyRequest = -1;
+volatile int gaitModeRequest = -1;
+volatile int swayRequest = -1;
+volatile float stepHeightRequest[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+
+
+
+void takeRequests()
+{
+    __disable_irq();
+    int policy = stepPolicyRequest;
+    int mode = gaitModeRequest;
+    int sway = swayRequest;
+    stepPolicyRequest = -1;
+    gaitModeRequest = -1;
+    swayRequest = -1;
+    float height[4];
+    for (int i = 0; i < 4; ++i)
     {
-        if (stepping)
-        {
-            TMat.identity();
-            return false;
-        }
-        else 
-        {
-            leg[next]->reset(0.8);
-            stepping = true;
-        }
+        height[i] = stepHeightRequest[i];
+        stepHeightRequest[i] = -1.0f;
     }
-    else
+    __enable_irq();
+    
+    if (policy >= 0) setStepPolicy((step_policy_t)policy);
+    if (mode >= 0) setGaitMode((gait_mode_t)mode);
+    if (sway >= 0) setBodySway(sway != 0);
+    for (int i = 0; i < 4; ++i)
     {
-//        // If unstable, move towards a stable position
-//        vector3 n;
-//        n.x = point2[next].y - point1[next].y;
-//        n.y = point1[next].x - point2[next].x;
-//        n = n.unit() * MAXSPEED * PERIOD;
-//        TMat.identity().translate(n).inverse();
-//        return false;
+        if (height[i] >= 0.0f) leg[i]->setStepHeight(height[i]);
     }
+}
+
+
+
+// steps                footstep policy
+// steps greedy         the leg closest to its edge, stopping while one steps
+// steps lookahead      planned ahead, slowing down rather than stopping
+CmdHandler* steps(Terminal*, const char* input)
+{
+    if (!strcmp(input, "steps greedy")) stepPolicyRequest = STEP_GREEDY;
+    else if (!strcmp(input, "steps lookahead")) stepPolicyRequest = STEP_LOOKAHEAD;
     
-    for (int i = 0; i < 4; ++i)
+    int policy = stepPolicyRequest >= 0 ? stepPolicyRequest : stepPolicy();
+    textOut.write(policy == STEP_GREEDY ? "Steps greedy\n" : "Steps lookahead\n");
+    return NULL;
+}
+
+
+
+// gait                 gait mode
+// gait MODE            crawl, amble or trot
+CmdHandler* gait(Terminal*, const char* input)
+{
+    char output[64];
+    
+    for (int m = 0; m < GAIT_MODES; ++m)
     {
-        leg[i]->apply();
+        if (!strncmp(input, "gait ", 5) && !strcmp(input + 5, gaitModeName((gait_mode_t)m))) gaitModeRequest = m;
     }
     
-    // Debug info
-    led1 = stability[0] > borderMin;
-    led2 = stability[1] > borderMin;
-    led3 = stability[2] > borderMin;
-    led4 = stability[3] > borderMin;
+    int mode = gaitModeRequest >= 0 ? gaitModeRequest : gaitMode();
+    TextLine line(output, 64);
+    line.text("Gait ").text(gaitModeName((gait_mode_t)mode)).put('\n');
+    textOut.write(output, line.length());
+    return NULL;
+}
+
+
+
+// sway                 body sway
+// sway on|off          sway the body over the support of the next leg to
+//                      lift, rather than drag a foot that can't
+CmdHandler* sway(Terminal*, const char* input)
+{
+    if (!strcmp(input, "sway on")) swayRequest = 1;
+    else if (!strcmp(input, "sway off")) swayRequest = 0;
     
-    return true;
+    bool on = swayRequest >= 0 ? swayRequest != 0 : bodySway();
+    textOut.write(on ? "Sway on\n" : "Sway off\n");
+    return NULL;
 }
 
 
 
-void resetLegs()
+// swing                swing time and height of each leg
+// swing HEIGHT         set the height of every leg, in m
+// swing LEG HEIGHT     set one leg, A to D
+CmdHandler* swing(Terminal*, const char* input)
 {
-    matrix4 T;
-    legA.reset(-0.6f);
-    while (legA.getStepping())
+    char output[128];
+    char name;
+    float height;
+    int first = 0, last = -1;
+    
+    if (sscanf(input, "swing %c %f", &name, &height) == 2 && name >= 'A' && name <= 'D')
     {
-        legA.update(T);
-        legA.apply();
+        first = last = name - 'A';
     }
-    legB.reset(-0.1f);
-    while (legB.getStepping())
+    else if (sscanf(input, "swing %f", &height) == 1)
     {
-        legB.update(T);
-        legB.apply();
+        last = 3;
     }
-    legC.reset(0.4f);
-    while (legC.getStepping())
+    
+    if (last >= 0 && (height < 0.01f || height > 0.08f))
     {
-        legC.update(T);
-        legC.apply();
+        textOut.write("Height 0.01 to 0.08 m\n");
+        return NULL;
     }
-    legD.reset(0.9f);
-    while (legD.getStepping())
+    for (int i = first; i <= last; ++i)
+        stepHeightRequest[i] = height;
+    
+    TextLine line(output, 128);
+    for (int i = 0; i < 4; ++i)
     {
-        legD.update(T);
-        legD.apply();
+        float h = stepHeightRequest[i];
+        line.put('A' + i).text(" ").fixed(leg[i]->getStepTime(), 2).text(" s ");
+        line.fixed(h >= 0.0f ? h : leg[i]->getStepHeight(), 3).text(" m\n");
     }
+    textOut.write(output, line.length());
+    return NULL;
+}
+
+
+
+// Runs a command and records what it cost, which is what it takes from the
+// loop if it comes in while walking. Output only costs the copy into the
+// terminal ring.
+template<CmdHandler* (*command)(Terminal*, const char*)>
+CmdHandler* timed(Terminal* terminal, const char* input)
+{
+    PROFILE_BEGIN(PROFILE_COMMAND);
+    CmdHandler* next = command(terminal, input);
+    PROFILE_END(PROFILE_COMMAND);
+    return next;
 }
 
 
 
-void setupLegs()
+// Telemetry goes out once per controller frame: on the ACK of the next one,
+// or in the gap after this one while the controller listens. The feet do not
+// fit in a frame with the rest, so the two take turns. Returns true if the
+// timing went out.
+bool sendTelemetry(int period, int tick, int tickMax)
 {
-    // Set leg parameters
-    legA.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
-    legB.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
-    legC.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
-    legD.setDimensions(DIM_A, DIM_B, DIM_C, DIM_D);
-    legA.setAngleOffsets(0.7853982f, 0.0f, 0.0f);
-    legB.setAngleOffsets(0.7853982f, 0.0f, 0.0f);
-    legC.setAngleOffsets(0.7853982f, 0.0f, 0.0f);
-    legD.setAngleOffsets(0.7853982f, 0.0f, 0.0f);
-    legA.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
-    legB.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
-    legC.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
-    legD.setStepCircle(CIRCLE_X, CIRCLE_Y, CIRCLE_Z, CIRCLE_R);
-    legA.theta.calibrate(1130, 2080, 45.0f, -45.0f);
-    legA.phi.calibrate(1150, 2080, 70.0f, -45.0f);
-    legA.psi.calibrate(1985, 1055, 70.0f, -60.0f);
-    legB.theta.calibrate(990, 1940, 45.0f, -45.0f);
-    legB.phi.calibrate(1105, 2055, 70.0f, -45.0f);
-    legB.psi.calibrate(2090, 1150, 70.0f, -60.0f);
-    legC.theta.calibrate(1930, 860, 45.0f, -45.0f);
-    legC.phi.calibrate(1945, 1000, 70.0f, -45.0f);
-    legC.psi.calibrate(1085, 2005, 70.0f, -60.0f);
-    legD.theta.calibrate(2020, 1080, 45.0f, -45.0f);
-    legD.phi.calibrate(2085, 1145, 70.0f, -45.0f);
-    legD.psi.calibrate(1070, 2010, 70.0f, -60.0f);
-    
-    // Initialize leg position deltas
-    legA.nDeltaPosition = vector3(0.0f, 0.01f, 0.0f);
-    legB.nDeltaPosition = vector3(0.0f, -0.01f, 0.0f);
-    legC.nDeltaPosition = vector3(0.0f, 0.01f, 0.0f);
-    legD.nDeltaPosition = vector3(0.0f, -0.01f, 0.0f);
-    
-    // Go to initial position
-    legA.move(vector3(0.15f, 0.15f, 0.05f));
-    legB.move(vector3(0.15f, 0.15f, 0.05f));
-    legC.move(vector3(0.15f, 0.15f, 0.05f));
-    legD.move(vector3(0.15f, 0.15f, 0.05f));
-    legA.theta.enable(); wait(0.1f);
-    legB.theta.enable(); wait(0.1f);
-    legC.theta.enable(); wait(0.1f);
-    legD.theta.enable(); wait(0.1f);
-    legA.phi.enable(); wait(0.1f);
-    legB.phi.enable(); wait(0.1f);
-    legC.phi.enable(); wait(0.1f);
-    legD.phi.enable(); wait(0.1f);
-    legA.psi.enable(); wait(0.1f);
-    legB.psi.enable(); wait(0.1f);
-    legC.psi.enable(); wait(0.1f);
-    legD.psi.enable(); wait(0.1f);
-    wait(0.4f);
-    legA.reset(-0.6f);
-    legB.reset(-0.1f);
-    legC.reset(0.4f);
-    legD.reset(0.9f);
-    matrix4 T;
-    while (legA.getStepping())
+    static uint8_t seq = 0;
+    radio_frame_t frame;
+    
+    frame.seq = seq;
+    if (seq & 1)
     {
-        legA.update(T);
-        legA.apply();
-        legB.update(T);
-        legB.apply();
-        legC.update(T);
-        legC.apply();
-        legD.update(T);
-        legD.apply();
+        frame.types = (1<<MSG_STABILITY) | (1<<MSG_TIMING);
+        if (latencyTrace.haveLast)
+        {
+            // Latest frame to reach the servos, so the controller can add on
+            // its own side
+            const StageHistogram& h = latencyTrace.stages[LATENCY_ROBOT];
+            frame.types |= 1<<MSG_LATENCY;
+            frame.latencyFrame = latencyTrace.lastFrame;
+            frame.latency = latencyTrace.lastLatency < 0xffff ? latencyTrace.lastLatency : 0xffff;
+            frame.latencyP99 = h.percentile(0.99f) < 0xffff ? h.percentile(0.99f) : 0xffff;
+            frame.latencyMax = h.max < 0xffff ? h.max : 0xffff;
+        }
+        for (int i = 0; i < 4; ++i)
+            frame.stability[i] = frameUnits(gaitStatus.stability[i]);
+        frame.period = period < 0xffff ? period : 0xffff;
+        frame.tick = tick < 0xffff ? tick : 0xffff;
+        frame.tickMax = tickMax < 0xffff ? tickMax : 0xffff;
     }
+    else
+    {
+        frame.types = 1<<MSG_FEET;
+        for (int i = 0; i < 4; ++i)
+        {
+            vector3 p = QMat[i]*leg[i]->getFootPosition();
+            frame.feet[i][0] = frameUnits(p.x);
+            frame.feet[i][1] = frameUnits(p.y);
+            frame.feet[i][2] = frameUnits(p.z);
+        }
+    }
+    
+    bool sent = (RADIO_LINK == LINK_ACK_PAYLOAD) ? radio.setAckPayload(frame) : radio.transmit(frame);
+    if (!sent) return false;
+    ++seq;
+    return frame.types & (1<<MSG_TIMING);
 }
 
 
 
-float calcStability(vector3 p1, vector3 p2)
+// Background work, one tier each. See Scheduler.h.
+bool radioTask()
 {
-    float lx, ly, vx, vy;
-    lx = p2.x - p1.x;
-    ly = p2.y - p1.y;
-    vx = -p1.x;
-    vy = -p1.y;
-    
-    return (ly*vx - lx*vy)/sqrt(lx*lx + ly*ly);
+    radio.service();
+    return false;
 }
 
+
+
+// Set by the tick when a new controller frame wants an answer
+volatile bool telemetryDue = false;
+int telemetryPeriod, telemetryTick, tickMax;
+
+bool telemetryTask()
+{
+    if (!telemetryDue) return false;
+    telemetryDue = false;
+    if (sendTelemetry(telemetryPeriod, telemetryTick, tickMax)) tickMax = 0;
+    return false;
+}
+
+
+
+bool logTask()
+{
+    dataLog.service();
+    return dataLog.writing() && (dataLog.blocks() > 1 || dataLog.stopping());
+}
+
+
+
+// The UART FIFO has no interrupt of its own here, so it is filled once per
+// release and the processor sleeps in between. Polling it until the ring is
+// empty kept the scheduler awake for about 180 ms with a full ring at 115200
+// baud. At 200 Hz a fill per tick still sends 3200 characters a second.
+uint32_t terminalRelease = 0;
+
+bool terminalTask()
+{
+    dumpService();
+    if (terminalRelease == scheduler.ticks) return false;
+    terminalRelease = scheduler.ticks;
+    textOut.service();
+    return false;
+}
+
+
+
+int main()
+{
+    Timer deltaTimer;
+    Terminal terminal;
+    
+    terminal.addCommand("log", &timed<log>);
+    terminal.addCommand("leg", &timed<legpos>);
+    terminal.addCommand("prof", &timed<prof>);
+    terminal.addCommand("lat", &timed<lat>);
+    terminal.addCommand("radio", &timed<radiostat>);
+    terminal.addCommand("sched", &timed<sched>);
+    terminal.addCommand("rate", &timed<rate>);
+    terminal.addCommand("steps", &timed<steps>);
+    terminal.addCommand("gait", &timed<gait>);
+    terminal.addCommand("swing", &timed<swing>);
+    terminal.addCommand("sway", &timed<sway>);
+    
+    cycleCounterStart();
+    if (RADIO_PAIR >= 0) radio.setSchedule(&arena);
+    radio.reset(RADIO_LINK);
+    setupLegs();
+    setupTransforms();
+    
+    scheduler.setTask(SCHED_RADIO, &radioTask);
+    scheduler.setTask(SCHED_TELEMETRY, &telemetryTask);
+    scheduler.setTask(SCHED_LOG, &logTask);
+    scheduler.setTask(SCHED_TERMINAL, &terminalTask);
+    
+    uint32_t lastController = 0;
+    
+    // Start timer
+    deltaTimer.start();
+    scheduler.start(PERIOD);
+    
+    while (true)
+    {
+        // Radio, telemetry, log and terminal output are done while waiting
+        // for the release, never during a control tick
+        scheduler.waitRelease();
+        
+        // The actual period, for the log and telemetry
+        float period = deltaTimer.read();
+        deltaTimer.reset();
+        uint32_t tickStart = radio.time();
+        
+        // Everything received so far, as one snapshot for this tick
+        radioState = radio.poll();
+        latencyTrace.tickStart(radioState.controllerFrame, radioState.controllerTime, tickStart);
+        takeRequests();
+        controlTick(radioState.controller, period);
+        if (gaitStatus.moved) latencyTrace.applied(gaitStatus.applyCycles);
+        
+        int tick = deltaTimer.read_us();
+        if (tick > tickMax) tickMax = tick;
+        dataLog.tick(tickStart, (int)(period*1000000.0f), tick, radioState.controller, radioState.controllerFrame);
+        
+        // Answer each new controller frame
+        if (radioState.controllerTime != lastController)
+        {
+            lastController = radioState.controllerTime;
+            telemetryPeriod = (int)(period*1000000.0f);
+            telemetryTick = tick;
+            telemetryDue = true;
+        }
+        
+        scheduler.tickDone();
+    } // while (true)
+} // main()